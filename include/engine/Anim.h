@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Texture.h"
+
+/* Animation registry: clip data (frames, fps, loop mode) is defined
+   once and referenced by small integer ID, instead of every entity
+   carrying its own copy. Instance state lives in contiguous arrays
+   and one anim_update_all call advances every instance per tick. */
+
+#define ANIM_MAX_CLIPS 64
+#define ANIM_MAX_INSTANCES 8192
+
+typedef int AnimClipId;     // -1 = invalid
+typedef int AnimInstId;     // -1 = invalid
+
+typedef enum AnimLoop
+{
+    ANIM_LOOP,              // wrap to frame 0
+    ANIM_ONCE,              // hold the last frame
+} AnimLoop;
+
+/* clip definition (frames array is shared with the caller, not copied) */
+AnimClipId anim_register_clip(Texture** frames, int count, float fps, AnimLoop loop);
+
+/* instances */
+AnimInstId anim_spawn(AnimClipId clip);
+void       anim_kill(AnimInstId inst);
+void       anim_set_clip(AnimInstId inst, AnimClipId clip);  // resets only on change
+int        anim_done(AnimInstId inst);                       // 1 when an ANIM_ONCE clip finished
+Texture*   anim_frame(AnimInstId inst);                      // current frame, NULL if invalid
+
+/* advance every live instance in one linear pass */
+void anim_update_all(float dt);
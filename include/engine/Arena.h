@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stddef.h>
+
+/* Allocator family for steady-state zero-malloc frames.
+
+   Arena: one upfront block, bump-pointer alloc, O(1) reset — for
+   level-lifetime data that dies all at once. Scratch: a global arena
+   for transient per-frame data (collision candidate lists, command
+   buffers, strings) reset automatically in window_present. MemPool:
+   fixed-size slots with a free list, for objects that churn like
+   particles and projectiles.
+
+   Every malloc the engine is forced into at runtime (scratch
+   overflow and similar fallbacks) is counted through
+   mem_note_heap_alloc; the HUD shows the per-frame total so "zero
+   heap allocations" is a number on screen, not a hope. */
+
+typedef struct Arena
+{
+    unsigned char* base;
+    size_t cap;
+    size_t used;
+    size_t high;        // high-water mark since init
+} Arena;
+
+int   arena_init(Arena* a, size_t cap);
+void  arena_destroy(Arena* a);
+void* arena_alloc(Arena* a, size_t size);   // 16-aligned; NULL when full
+void  arena_reset(Arena* a);                // O(1), keeps the block
+
+/* ---- per-frame scratch ---- */
+
+int    scratch_init(size_t cap);
+void   scratch_shutdown(void);
+void*  scratch_alloc(size_t size);      // falls back to counted malloc when full
+size_t scratch_high_water(void);
+
+/* Called by window_present: resets the scratch arena, frees any
+   overflow fallbacks, and rolls the per-frame alloc counter. */
+void   scratch_frame_end(void);
+
+/* ---- fixed-size pool ---- */
+
+typedef struct MemPool
+{
+    unsigned char* slots;
+    int* next_free;     // free list through slot indices
+    int head;           // -1 = exhausted
+    size_t item_size;
+    int cap;
+    int in_use;
+} MemPool;
+
+int   mempool_init(MemPool* p, size_t item_size, int cap);
+void  mempool_destroy(MemPool* p);
+void* mempool_alloc(MemPool* p);            // NULL when exhausted
+void  mempool_free(MemPool* p, void* item);
+
+/* ---- allocation accounting ---- */
+
+void   mem_note_heap_alloc(void);       // runtime malloc happened
+size_t mem_frame_heap_allocs(void);     // count for the last full frame
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <SDL.h>
+#include "Texture.h"
+
+#define ATLAS_MAX_ENTRIES 256
+#define ATLAS_NAME_MAX 64
+
+typedef struct AtlasEntry
+{
+    char name[ATLAS_NAME_MAX];
+    SDL_Rect rect;
+} AtlasEntry;
+
+typedef struct Atlas
+{
+    Texture sheet;      // owns the packed SDL_Texture
+    AtlasEntry entries[ATLAS_MAX_ENTRIES];
+    int count;
+} Atlas;
+
+/* Load a pre-packed sheet plus description file.
+   Description format: one region per line, "name x y w h". */
+int atlas_load(Atlas* a, SDL_Renderer* renderer,
+               const char* image_path, const char* desc_path);
+
+/* Pack loose images into one sheet at load time.
+   Entry names are the file paths passed in. */
+int atlas_build(Atlas* a, SDL_Renderer* renderer,
+                const char** paths, int count);
+
+/* Look up a region by name; fills a non-owning Texture view into the
+   sheet (draw it like any other Texture). Returns 0 if not found. */
+int atlas_get(Atlas* a, const char* name, Texture* out);
+
+void atlas_destroy(Atlas* a);
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Math.h"
+
+/* First-class camera: follow with optional smoothing and dead-zone,
+   plus one shared culling primitive so every draw path asks the same
+   cheap question instead of re-deriving visibility by hand. */
+
+typedef struct Camera
+{
+    Vec2 pos;           // top-left of the view in world coords
+    float view_w;
+    float view_h;
+
+    float smoothing;    // 0 = hard snap; higher = faster catch-up (per second)
+    float dead_w;       // dead-zone box centered in the view; 0 = none
+    float dead_h;
+} Camera;
+
+void camera_init(Camera* c, float view_w, float view_h);
+
+/* track a world point (usually the player's center) */
+void camera_follow(Camera* c, Vec2 target, float dt);
+void camera_clamp_world(Camera* c, float world_w, float world_h);
+
+/* visible world rect */
+void cam_visible_aabb(const Camera* c, float* x, float* y, float* w, float* h);
+
+/* 1 when the rect touches the view — the shared culling primitive */
+int  cam_cull_rect(const Camera* c, float x, float y, float w, float h);
+
+/* world -> screen */
+Vec2 camera_apply(const Camera* c, Vec2 world_pos);
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <SDL.h>
+#include "SpriteBatch.h"
+
+/* Fast on-screen text for stats/HUD use: a builtin 3x5 microfont is
+   baked into one small texture at init and glyphs are emitted as
+   quads through the sprite batcher — live numbers cost microseconds
+   instead of console I/O. Covers 0-9 A-Z space . - : % / (lowercase
+   is uppercased; anything else prints as a space). */
+
+int  dtext_init(SDL_Renderer* renderer);
+void dtext_shutdown(void);
+
+/* scale 1 = 3x5 px glyphs, advance 4 px per character */
+void dtext_draw(SpriteBatch* batch, const char* s, float x, float y, int scale);
+
+/* number paths that never touch sprintf on the frame path */
+void dtext_draw_int(SpriteBatch* batch, long v, float x, float y, int scale);
+void dtext_draw_float(SpriteBatch* batch, float v, int decimals,
+                      float x, float y, int scale);
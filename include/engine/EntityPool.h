@@ -0,0 +1,59 @@
+#pragma once
+
+#include <SDL.h>
+#include "Math.h"
+#include "Texture.h"
+#include "SpriteBatch.h"
+
+/* Fixed-capacity pool for bulk entities (particles, enemies, pickups).
+   Unlike Entity, state lives in separate contiguous arrays (SoA) so
+   pool_update_all walks memory linearly instead of chasing pointers.
+   Slots are recycled through a free-list; nothing allocates after init. */
+
+typedef int EntityId;   // slot index into the pool, -1 = invalid
+
+typedef struct EntityPool
+{
+    int capacity;
+    int high;           // highest slot ever handed out + 1; linear walks stop here
+    int alive_count;
+
+    // hot data
+    float* pos_x;
+    float* pos_y;
+    float* vel_x;
+    float* vel_y;
+
+    // animation state (frame arrays are shared with callers, not copied)
+    Texture*** frames;  // frames[i] = Texture* array for slot i, NULL = none
+    int*   anim_count;
+    float* anim_fps;
+    float* anim_t;
+    int*   anim_index;
+
+    Texture** tex;      // current texture per slot (auto from anim)
+
+    Uint8* alive;
+    int* free_list;     // stack of recycled slots
+    int free_count;
+} EntityPool;
+
+int  pool_init(EntityPool* p, int capacity);
+void pool_destroy(EntityPool* p);
+
+EntityId pool_spawn(EntityPool* p, float x, float y);   // -1 when full
+void     pool_kill(EntityPool* p, EntityId id);
+
+void pool_set_vel(EntityPool* p, EntityId id, float vx, float vy);
+void pool_set_tex(EntityPool* p, EntityId id, Texture* tex);
+void pool_play_anim(EntityPool* p, EntityId id, Texture** frames, int count, float fps);
+
+/* One linear pass over the arrays: integrate positions, advance anims */
+void pool_update_all(EntityPool* p, float dt);
+
+/* Same work fanned out over the job system (falls back to the serial
+   pass when jobs_init hasn't run) */
+void pool_update_all_parallel(EntityPool* p, float dt);
+
+/* Emit every live entity into the batcher in one pass */
+void pool_draw_all(EntityPool* p, SpriteBatch* batch, Vec2 cam);
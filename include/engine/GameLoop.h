@@ -0,0 +1,25 @@
+#pragma once
+
+#include <SDL.h>
+
+/* update runs at a fixed dt, zero or more times per frame.
+   render runs once per frame; alpha in [0,1) is how far the current
+   frame sits between the last two ticks, for interpolated positions. */
+typedef void (*EngineUpdateFn)(float dt, void* user);
+typedef void (*EngineRenderFn)(float alpha, void* user);
+
+/* Fixed-timestep loop (accumulator pattern). Polls SDL events once
+   per frame, feeds them to the Input layer, and stops on SDL_QUIT or
+   engine_loop_stop(). */
+void engine_loop(EngineUpdateFn update, EngineRenderFn render,
+                 int tick_hz, void* user);
+
+void engine_loop_stop(void);
+
+/* Headless loop: run exactly `ticks` fixed-dt updates back to back,
+   as fast as the CPU allows — no rendering, no event pump, no
+   pacing. Same dt as engine_loop at the same tick_hz, so server and
+   client simulations stay in lockstep. Returns the number of ticks
+   actually run (engine_loop_stop can end it early). */
+long engine_run_ticks(EngineUpdateFn update, int tick_hz, long ticks,
+                      void* user);
@@ -1,13 +1,34 @@
 #include <SDL.h>
 #include <SDL_image.h>
 
+#include "Arena.h"
 #include "RenderWindow.h"
 #include "Texture.h"
+#include "SpriteBatch.h"
+#include "Atlas.h"
+#include "TexCache.h"
+#include "TexLoader.h"
+#include "Pak.h"
+#include "Tilemap.h"
+#include "WorldStream.h"
+#include "RenderCache.h"
+#include "RenderQueue.h"
+#include "Layers.h"
+#include "Viewport.h"
 #include "Input.h"
+#include "Replay.h"
 #include "Math.h"
+#include "Camera.h"
 #include "Physics.h"
 #include "Entity.h"
+#include "EntityPool.h"
+#include "Anim.h"
+#include "Particles.h"
 
 #include "Time.h"
+#include "Jobs.h"
+#include "GameLoop.h"
+#include "Profiler.h"
 #include "InputAxis.h"
-#include "DrawHelpers.h"
\ No newline at end of file
+#include "DrawHelpers.h"
+#include "DebugText.h"
\ No newline at end of file
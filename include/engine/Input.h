@@ -1,7 +1,15 @@
 #pragma once
 #include <SDL.h>
 
-void UpdateInput(void);
+/* Event-consuming input layer: call input_new_frame() at the top of
+   the frame, then feed every polled event through
+   input_process_event(). Edge state (pressed/released) is tracked as
+   a dirty-list of the keys that actually changed, so the frame
+   boundary touches a handful of entries instead of copying the whole
+   keyboard array. engine_loop does this wiring for you. */
+
+void input_new_frame(void);
+void input_process_event(const SDL_Event* e);
 
 int IsKeyDown(SDL_Scancode key);
 int IsKeyPressed(SDL_Scancode key);
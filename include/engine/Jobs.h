@@ -0,0 +1,20 @@
+#pragma once
+
+#include <SDL.h>
+
+/* Small job system: a worker pool on SDL_Thread plus one primitive,
+   job_parallel_for, which splits an index range into chunks that the
+   workers and the calling thread grab from a shared atomic cursor.
+   Update-stage work (entity pools, particles, grid rebuilds) fans out
+   here; render submission stays on the main thread. */
+
+typedef void (*JobRangeFn)(int begin, int end, void* user);
+
+int  jobs_init(int worker_count);   // <= 0 picks cores-1; 1+ forces a count
+void jobs_shutdown(void);
+int  jobs_worker_count(void);
+
+/* Runs fn over [0, count) in chunks of `chunk`, in parallel across the
+   workers and the calling thread; returns when the range is done.
+   Falls back to one inline call when the pool isn't running. */
+void job_parallel_for(int count, int chunk, JobRangeFn fn, void* user);
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <SDL.h>
+#include "Texture.h"
+#include "SpriteBatch.h"
+#include "RenderQueue.h"
+#include "RenderCache.h"
+#include "Camera.h"
+
+/* Z-ordered layer compositor. Scenes are split into named layers
+   (background, tiles, entities, ui, ...) that each hold their own
+   command list and composite back-to-front, so draw order stops
+   depending on call order in main and batching works across call
+   sites. Static layers bake into a target texture through the
+   render cache and cost one RenderCopy per frame until invalidated;
+   each layer has a parallax factor applied to the camera (1 = world
+   speed, 0 = screen-fixed, so UI is just a parallax-0 layer). */
+
+#define LAYERS_MAX 16
+#define LAYER_NAME_MAX 32
+
+typedef struct Layer
+{
+    char name[LAYER_NAME_MAX];
+    int z;                  // low z composites first
+    float parallax;
+
+    RenderCmd* cmds;        // world-space commands (screen-space at parallax 0)
+    int count;
+    int cap;
+
+    int is_static;
+    RenderCache cache;      // valid when is_static
+
+    SpriteBatch* batch;     // shared batcher, used by the bake callback
+} Layer;
+
+typedef struct LayerCompositor
+{
+    SDL_Renderer* renderer;
+    SpriteBatch* batch;
+    Layer layers[LAYERS_MAX];
+    int count;
+} LayerCompositor;
+
+int  layers_init(LayerCompositor* lc, SDL_Renderer* renderer, SpriteBatch* batch);
+void layers_destroy(LayerCompositor* lc);
+
+/* Add a layer; returns its id or -1 when full. cap <= 0 = default.
+   Static layers cover a fixed world region and re-bake only when
+   invalidated — push their commands once, then just composite. */
+int  layer_add(LayerCompositor* lc, const char* name, int z, float parallax,
+               int cap);
+int  layer_add_static(LayerCompositor* lc, const char* name, int z,
+                      float parallax, int cap,
+                      float world_x, float world_y, int w, int h);
+int  layer_find(const LayerCompositor* lc, const char* name);
+
+/* Record into a layer (dropped when full). Coordinates are world
+   space; the camera and parallax are applied at composite time. */
+void layer_push(LayerCompositor* lc, int id, Texture* tex, const SDL_Rect* src,
+                float x, float y, float w, float h);
+void layer_push_tex(LayerCompositor* lc, int id, Texture* tex, float x, float y);
+
+/* Re-bake a static layer on its next composite. */
+void layer_invalidate(LayerCompositor* lc, int id);
+
+/* Clear the dynamic layers' command lists (start of frame).
+   Static layers keep their commands. */
+void layers_begin(LayerCompositor* lc);
+
+/* Composite every layer back-to-front: static layers are one
+   RenderCopy each, dynamic layers replay through the batcher with
+   the parallax-scaled camera offset. */
+void layers_composite(LayerCompositor* lc, const Camera* cam);
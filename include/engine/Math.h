@@ -40,3 +40,18 @@ static inline Vec2 cam_unapply(Vec2 screen_pos, Vec2 cam)
     // screen -> world
     return vec2(screen_pos.x + cam.x, screen_pos.y + cam.y);
 }
+
+/* ================= BULK KERNELS ================= */
+/* Array forms of the scalar ops for the SoA buffers used by the
+   entity pool and particles (separate x/y arrays). SSE/NEON where
+   available, scalar fallback otherwise — see src/engine/mathn.c. */
+
+/* dst[i] = a[i] + b[i] */
+void vec2_add_n(float* dst, const float* a, const float* b, int n);
+
+/* dst[i] += v[i] * s  — the pos += vel * dt pattern */
+void vec2_scale_add_n(float* dst, const float* v, float s, int n);
+
+/* world -> screen for whole position arrays */
+void cam_apply_n(float* dst_x, float* dst_y,
+                 const float* x, const float* y, Vec2 cam, int n);
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <SDL.h>
+#include "Texture.h"
+
+/* Packed asset bundle (.sdlpak, built by tools/pak/pack_assets.py):
+   the whole bundle is pulled into memory with one read, and textures
+   upload as slices of that buffer — raw RGBA32 entries go straight
+   through SDL_UpdateTexture with no decode on the startup path. */
+
+#define PAK_NAME_MAX 64
+
+typedef struct PakEntry
+{
+    char name[PAK_NAME_MAX];
+    Uint32 offset;      // from the start of the file
+    Uint32 size;
+    Uint32 format;      // 0 = raw RGBA32 pixels, 1 = encoded image bytes
+    Uint32 w;           // raw entries only
+    Uint32 h;
+} PakEntry;
+
+typedef struct Pak
+{
+    Uint8* data;        // the whole file
+    size_t size;
+    const PakEntry* entries;    // points into data
+    int count;
+} Pak;
+
+int  pak_open(Pak* p, const char* path);
+void pak_close(Pak* p);
+
+const PakEntry* pak_find(const Pak* p, const char* name);
+
+/* Load a bundled image into a Texture. Raw entries skip decoding
+   entirely; encoded entries decode from memory (no file I/O). */
+int pak_load_tex(Pak* p, SDL_Renderer* renderer, const char* name, Texture* out);
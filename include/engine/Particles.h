@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Math.h"
+#include "Texture.h"
+#include "SpriteBatch.h"
+
+/* Dedicated particle subsystem: a fixed arena of POD particles stored
+   SoA and kept dense by swap-remove, so particles_update is a straight
+   linear pass with no alive checks and no allocation. All particles in
+   a system share one Texture (atlas region), so particles_draw emits
+   the whole system as a single geometry submission. */
+
+typedef struct ParticleSystem
+{
+    int capacity;
+    int count;          // live particles, always packed at the front
+
+    float* pos_x;
+    float* pos_y;
+    float* vel_x;
+    float* vel_y;
+    float* life;        // seconds remaining
+    float* size;        // quad side length
+
+    Texture* tex;
+    float gravity;      // applied to vel_y each second
+} ParticleSystem;
+
+int  particles_init(ParticleSystem* ps, int capacity, Texture* tex);
+void particles_destroy(ParticleSystem* ps);
+
+/* burst: spawn n particles at (x, y) with velocities jittered inside
+   the given ranges */
+void particles_emit(ParticleSystem* ps, int n, float x, float y,
+                    float vel_min_x, float vel_max_x,
+                    float vel_min_y, float vel_max_y,
+                    float life, float size);
+
+void particles_update(ParticleSystem* ps, float dt);
+void particles_draw(ParticleSystem* ps, SpriteBatch* batch, Vec2 cam);
+
+/* steady emission at a fixed rate on top of the burst API */
+typedef struct ParticleEmitter
+{
+    ParticleSystem* ps;
+    float x, y;
+    float rate;         // particles per second
+    float acc;          // fractional spawn carry
+
+    float vel_min_x, vel_max_x;
+    float vel_min_y, vel_max_y;
+    float life;
+    float size;
+} ParticleEmitter;
+
+void emitter_update(ParticleEmitter* e, float dt);
@@ -19,6 +19,116 @@ void rect_bounce_window(float* x, float* y,
                          float w, float h,
                          float win_w, float win_h);
 
+/* ============== SWEPT AABB (narrow phase) ==============
+   Time-of-impact tests that stay correct however large vel*dt gets,
+   so fast movers can't tunnel through thin geometry. */
+
+/* Sweep rect A moving by (dx, dy) against static rect B.
+   Returns 1 on hit with *out_t in [0,1] (fraction of the motion) and
+   the contact normal in *out_nx/*out_ny; returns 0 (out_t = 1) when
+   the motion misses. Already-overlapping rects report no hit. */
+int sweep_rect(float ax, float ay, float aw, float ah,
+               float dx, float dy,
+               float bx, float by, float bw, float bh,
+               float* out_t, float* out_nx, float* out_ny);
+
+/* Earliest hit of a moving rect against `count` rects (flat x,y,w,h
+   quads). Returns the rect index or -1, filling t and the normal. */
+int sweep_rect_set(float ax, float ay, float aw, float ah,
+                   float dx, float dy,
+                   const float* rects, int count,
+                   float* out_t, float* out_nx, float* out_ny);
+
+/* Move a rect by vel*dt against a set of rects, stopping at contacts
+   and sliding along them; blocked velocity components are zeroed. */
+void sweep_resolve(float* x, float* y, float w, float h,
+                   float* vx, float* vy, float dt,
+                   const float* rects, int count);
+
+/* ============== SPATIAL GRID (broad phase) ==============
+   Uniform grid rebuilt every tick: grid_clear, then grid_insert each
+   dynamic AABB, then grid_query to get overlap candidates. Backed by
+   flat arrays sized at init — no per-cell allocation. Only candidates
+   returned here need the exact rect_overlaps test. */
+
+typedef struct SpatialGrid
+{
+    float cell_size;
+    int cols;
+    int rows;
+
+    int max_ids;        // ids passed to grid_insert must be < this
+    int max_entries;    // total (cell, id) pairs per tick
+
+    int* heads;         // cell -> first entry index, -1 = empty
+    int* entry_id;
+    int* entry_next;
+    int entry_count;
+
+    unsigned int* stamp;    // per-id marker so queries report each id once
+    unsigned int stamp_now;
+
+    unsigned int* layer;    // per-id collision layer, defaults to 1
+} SpatialGrid;
+
+int  grid_init(SpatialGrid* g, float cell_size, int cols, int rows,
+               int max_ids, int max_entries);
+void grid_destroy(SpatialGrid* g);
+
+void grid_clear(SpatialGrid* g);    // start-of-tick rebuild
+void grid_insert(SpatialGrid* g, int id, float x, float y, float w, float h);
+
+/* Fills out_ids with ids whose cells overlap the AABB (each id once).
+   Returns the number written, capped at max_out. */
+int  grid_query(SpatialGrid* g, float x, float y, float w, float h,
+                int* out_ids, int max_out);
+
+/* ============== LAYERS + STATIC INDEX ==============
+   Collision layers are plain bitfields: a body sits on one or more
+   layers and a query carries a mask; they interact when the bits
+   overlap. Immovable world rects go into a StaticIndex built once per
+   level — sorted by x so a query binary-searches to its x-interval and
+   never touches rects elsewhere in the world. Dynamic bodies stay in
+   the SpatialGrid. */
+
+static inline int layers_match(unsigned int layer, unsigned int mask)
+{
+    return (layer & mask) != 0;
+}
+
+typedef struct StaticIndex
+{
+    float* rects;           // x,y,w,h quads, sorted by x after build
+    unsigned int* layer;
+    int count;
+    int cap;
+
+    float max_w;            // widest rect, bounds the search window
+    int built;
+} StaticIndex;
+
+int  static_index_init(StaticIndex* s, int cap);
+void static_index_destroy(StaticIndex* s);
+
+/* Register an immovable rect. Call static_build before querying. */
+void static_add(StaticIndex* s, float x, float y, float w, float h,
+                unsigned int layer);
+
+/* Sort by x. Once per level, after the last static_add. */
+void static_build(StaticIndex* s);
+
+/* Fills out_ids with indices of static rects overlapping the AABB
+   whose layer matches mask. Returns the number written, capped at
+   max_out. Indices address s->rects (i * 4) and s->layer. */
+int  static_query(const StaticIndex* s, float x, float y, float w, float h,
+                  unsigned int mask, int* out_ids, int max_out);
+
+/* Per-id layers for the dynamic grid; ids default to layer 1.
+   grid_query is unfiltered, grid_query_mask skips non-matching ids. */
+void grid_set_layer(SpatialGrid* g, int id, unsigned int layer);
+int  grid_query_mask(SpatialGrid* g, float x, float y, float w, float h,
+                     unsigned int mask, int* out_ids, int max_out);
+
 /* Camera helpers (camera pos is top-left of view in world coords) */
 void cam_follow(float* cam_x, float* cam_y,
                 float target_x, float target_y,
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <SDL.h>
+
+/* Frame profiler on SDL_GetPerformanceCounter: wrap hot code in named
+   zones, call prof_frame_end once per frame, and read aggregated
+   stats (or draw the overlay) to see where frames go. Zones may nest;
+   names must be string literals (compared by pointer first). */
+
+#define PROF_MAX_ZONES 32
+#define PROF_HISTORY 120        // frames kept per zone
+#define PROF_MAX_DEPTH 8
+
+void prof_begin(const char* name);
+void prof_end(void);
+
+void prof_frame_end(void);      // closes the frame, pushes zone totals into history
+
+typedef struct ProfZoneStats
+{
+    const char* name;
+    float last_ms;              // most recent frame
+    float min_ms;               // over the history window
+    float avg_ms;
+    float max_ms;
+} ProfZoneStats;
+
+/* Fills stats for every zone seen so far; returns the count. */
+int prof_get_stats(ProfZoneStats* out, int max_out);
+
+/* Bar overlay: one row per zone, bar length proportional to last
+   frame's cost (px_per_ms pixels per millisecond). */
+void prof_draw_overlay(SDL_Renderer* renderer, int x, int y, float px_per_ms);
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <SDL.h>
+#include "Math.h"
+
+/* Static-geometry cache: bake a region of unchanging scenery into a
+   target texture once, then draw it with a single SDL_RenderCopy per
+   frame instead of re-issuing every tile. Call rcache_invalidate when
+   something in the region changes to re-bake on the next draw. */
+
+/* draws the region's content with the region's top-left at (0,0) */
+typedef void (*RenderCacheBakeFn)(SDL_Renderer* renderer, void* user);
+
+typedef struct RenderCache
+{
+    SDL_Texture* target;
+    int w;
+    int h;
+    float world_x;      // where the baked region sits in the world
+    float world_y;
+    int dirty;
+} RenderCache;
+
+int  rcache_init(RenderCache* c, SDL_Renderer* renderer,
+                 float world_x, float world_y, int w, int h);
+void rcache_destroy(RenderCache* c);
+
+void rcache_invalidate(RenderCache* c);
+
+/* one RenderCopy per frame; re-bakes through bake first when dirty */
+void rcache_draw(RenderCache* c, SDL_Renderer* renderer, Vec2 cam,
+                 RenderCacheBakeFn bake, void* user);
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <SDL.h>
+#include "Texture.h"
+#include "SpriteBatch.h"
+
+/* Double-buffered draw command queue. Update code records compact
+   commands (texture, dst rect, z) instead of touching the renderer;
+   rq_swap flips the buffers at end of update and rq_replay drains
+   LAST frame's commands through the batcher. That decouples
+   simulation from GPU submission — frame N+1 can start updating
+   while frame N is still being replayed — and replay sorts by
+   (z, texture), so draw order is explicit and texture runs stay
+   long for the batcher regardless of submission order. */
+
+typedef struct RenderCmd
+{
+    Texture* tex;
+    SDL_Rect src;       // ignored unless has_src
+    int has_src;
+    float x, y, w, h;
+    int z;              // low z draws first
+} RenderCmd;
+
+typedef struct RenderQueue
+{
+    RenderCmd* buf[2];  // [record] being filled, the other replayed
+    int count[2];
+    int cap;
+    int record;
+
+    int* order;         // scratch index array for the replay sort
+} RenderQueue;
+
+int  rq_init(RenderQueue* q, int cap);
+void rq_destroy(RenderQueue* q);
+
+/* Record into the current buffer (dropped when full). */
+void rq_push(RenderQueue* q, Texture* tex, const SDL_Rect* src,
+             float x, float y, float w, float h, int z);
+void rq_push_tex(RenderQueue* q, Texture* tex, float x, float y, int z);
+
+/* End of update: flip buffers so replay sees a finished frame. */
+void rq_swap(RenderQueue* q);
+
+/* Sort the previous frame's commands by (z, texture) and submit them
+   through the batcher (batch_begin/flush included). */
+void rq_replay(RenderQueue* q, SpriteBatch* b);
@@ -2,6 +2,8 @@
 
 #include <SDL.h>
 
+#define RW_MAX_DIRTY 64
+
 typedef struct RenderWindow
 {
     const char* title;
@@ -10,9 +12,72 @@ typedef struct RenderWindow
 
     SDL_Window* window;
     SDL_Renderer* renderer;
+
+    /* frame pacing: target_fps > 0 makes window_present sleep+spin to
+       the deadline on SDL_GetPerformanceCounter; missed_deadlines
+       counts frames that blew their budget */
+    int target_fps;
+    Uint64 frame_deadline;
+    int missed_deadlines;
+
+    /* opt-in dirty-region mode: callers mark changed screen rects and
+       only those regions get cleared; fully-clean frames skip the
+       redraw and present entirely (see window_begin_frame). Frames
+       accumulate in a persistent target texture — the window
+       backbuffer is undefined after present on accelerated backends,
+       so partial redraws can't rely on it */
+    int dirty_mode;
+    SDL_Rect dirty[RW_MAX_DIRTY];
+    int dirty_count;
+    int dirty_all;
+    SDL_Texture* persist;
+
+    /* headless mode: no window, renderer is a software renderer over
+       a tiny offscreen surface (see window_init_headless) */
+    int headless;
+    SDL_Surface* backbuffer;
 } RenderWindow;
 
 void window_init(RenderWindow* rw, const char* title, int width, int height);
+
+/* Headless init for servers and CI: creates no window and needs no
+   SDL_INIT_VIDEO (SDL_Init(0) is enough). rw->renderer is a software
+   renderer over a 1x1 offscreen surface, so every draw path —
+   draw_tex, the batcher, render targets — keeps working unchanged
+   and clips down to (almost) nothing; game code needs no branches.
+   Pair with engine_run_ticks to simulate faster than realtime. */
+void window_init_headless(RenderWindow* rw, int width, int height);
 void window_clear(RenderWindow* rw);
 void window_present(RenderWindow* rw);
-void window_destroy(RenderWindow* rw);
\ No newline at end of file
+void window_destroy(RenderWindow* rw);
+
+/* vsync / frame pacing (hard vsync stays the init default) */
+typedef enum WindowVsync
+{
+    WINDOW_VSYNC_OFF,       // uncapped (pair with a target FPS if wanted)
+    WINDOW_VSYNC_ON,        // wait for every refresh
+    WINDOW_VSYNC_ADAPTIVE,  // tear instead of stalling on a late frame
+} WindowVsync;
+
+/* returns 1 on success; adaptive falls back to hard vsync when the
+   backend can't do late-tearing */
+int  window_set_vsync(RenderWindow* rw, WindowVsync mode);
+
+void window_set_target_fps(RenderWindow* rw, int fps);  // 0 = uncapped
+int  window_missed_deadlines(const RenderWindow* rw);
+
+/* dirty-region mode (off by default = full redraw every frame) */
+void window_set_dirty_mode(RenderWindow* rw, int enable);
+void window_mark_dirty(RenderWindow* rw, int x, int y, int w, int h);
+void window_mark_all_dirty(RenderWindow* rw);
+
+/* Start a frame. Normal mode: clears everything, returns 1.
+   Dirty mode: returns 0 when nothing was marked (skip drawing AND
+   window_present — only the draw/present is skipped: frame pacing
+   and the per-frame scratch reset still run here); otherwise clears
+   just the marked regions, leaves them as the clip list for the
+   caller to redraw, and returns 1. */
+int window_begin_frame(RenderWindow* rw);
+
+/* dirty rects accumulated for this frame (valid until present) */
+const SDL_Rect* window_dirty_rects(const RenderWindow* rw, int* count);
\ No newline at end of file
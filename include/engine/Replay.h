@@ -0,0 +1,43 @@
+#pragma once
+
+#include <SDL.h>
+
+/* Deterministic input record/replay. Recording captures input deltas
+   (the key/mouse events, which are already state changes) tagged with
+   the fixed tick they landed on; playback synthesizes the same events
+   and feeds them back through the Input layer on the same ticks. With
+   fixed dt that makes a run bit-identical, so a reported frame spike
+   can be replayed under the profiler as often as needed — or faster
+   than realtime through engine_run_ticks in headless mode.
+
+   engine_loop records automatically while a recording is open. The
+   log also carries frame boundaries, because edge flags (pressed/
+   released) are cleared once per RENDER frame: a press is visible to
+   every tick of the frame it landed in, and playback must group
+   ticks the same way or IsKeyPressed diverges on multi-tick frames.
+   Drive playback per frame:
+
+       replay_play_begin("run.srec");
+       while (replay_playing())
+       {
+           input_new_frame();
+           int ticks = replay_play_frame();
+           for (int i = 0; i < ticks; i++)
+               game_update(dt, &g);
+       }
+
+   Log format: 16-byte header ("SREC", version, tick_hz) followed by
+   fixed 16-byte event records. Mouse motion is coalesced to the last
+   position per tick. */
+
+int  replay_record_begin(const char* path, int tick_hz);
+int  replay_recording(void);
+void replay_record_event(const SDL_Event* e);   // no-op when not recording
+void replay_record_tick(void);                  // once per fixed update tick
+void replay_record_frame(void);                 // once per render frame, after its ticks
+void replay_record_end(void);
+
+int  replay_play_begin(const char* path);       // returns tick_hz, 0 on error
+int  replay_playing(void);
+int  replay_play_frame(void);                   // feed this frame's events; returns its tick count
+void replay_play_end(void);
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <SDL.h>
+#include "Texture.h"
+
+/* Default sprite capacity before a push forces an early flush */
+#define SPRITEBATCH_DEFAULT_CAPACITY 8192
+
+typedef struct SpriteBatch
+{
+    SDL_Renderer* renderer;
+
+    SDL_Vertex* verts;      // 4 vertices per sprite
+    int* indices;           // 6 indices per sprite (prebuilt quad pattern)
+
+    int count;              // sprites queued in the current run
+    int capacity;           // sprites per flush
+
+    SDL_Texture* current;   // texture of the run being built
+} SpriteBatch;
+
+int  batch_init(SpriteBatch* b, SDL_Renderer* renderer, int capacity); // capacity <= 0 = default
+void batch_destroy(SpriteBatch* b);
+
+void batch_begin(SpriteBatch* b);                                      // start a fresh frame
+void batch_push(SpriteBatch* b, Texture* tex, const SDL_Rect* src,
+                float x, float y, float w, float h);                   // src = NULL -> whole texture
+void batch_push_tex(SpriteBatch* b, Texture* tex, float x, float y);   // uses tex draw_w/draw_h like draw_tex
+void batch_flush(SpriteBatch* b);                                      // submit queued sprites
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <SDL.h>
+#include "Texture.h"
+
+/* Path-keyed texture cache: the same file is decoded and uploaded
+   once, then shared. Handles are refcounted — pair every tex_acquire
+   with a tex_release; the cache owns the SDL_Texture and frees it on
+   the last release. Don't call destroy_tex on cached handles. */
+
+#define TEXCACHE_MAX 256
+
+Texture* tex_acquire(SDL_Renderer* renderer, const char* path);  // NULL on load failure
+void     tex_release(Texture* tex);
+
+/* Pre-scaled variant, keyed by (path, w, h): decoded once and
+   downscaled at load, so drawing at w x h samples small pixels
+   instead of GPU-minifying the full-res source every frame. Use
+   where you'd otherwise load_tex + scale_tex a big source down.
+   Each size is its own refcounted entry; release as usual. */
+Texture* tex_acquire_scaled(SDL_Renderer* renderer, const char* path,
+                            int w, int h);
+
+int  texcache_count(void);      // resident textures, for stats
+void texcache_shutdown(void);   // frees everything regardless of refcounts
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <SDL.h>
+#include "Texture.h"
+
+/* Background texture loading: a worker thread does the file read and
+   PNG decode, the render thread only performs the GPU upload when it
+   drains completions once per frame via texloader_pump. */
+
+/* tex is fully loaded on success, zeroed on failure; valid only for
+   the duration of the callback (copy it out) */
+typedef void (*TexLoadCallback)(Texture* tex, const char* path, void* user);
+
+int  texloader_init(void);      // spawns the decode thread
+void texloader_shutdown(void);  // drops queued work, joins the thread
+
+/* Queue a decode. Returns 0 if the loader is full or not running. */
+int  load_tex_async(const char* path, TexLoadCallback cb, void* user);
+
+/* Call once per frame on the render thread: uploads finished decodes
+   and fires their callbacks. */
+void texloader_pump(SDL_Renderer* renderer);
@@ -11,9 +11,24 @@ typedef struct Texture
 
     int draw_w;
     int draw_h;
+
+    /* atlas region: when has_src is set, width/height describe the
+       sub-rect and sheet_w/sheet_h the full SDL_Texture behind it */
+    SDL_Rect src;
+    int has_src;
+    int sheet_w;
+    int sheet_h;
 } Texture;
 
 int  load_tex(Texture* tex, SDL_Renderer* renderer, const char* path);
+
+/* Decode, downscale on the CPU (iterative 2x2 box filter, then a
+   final blit to the exact size), and upload at w x h. For sources
+   drawn far below native size this uploads the small pixels once
+   instead of letting the GPU minify the full-res texture every
+   sample — use through tex_acquire_scaled so variants are shared. */
+int  load_tex_scaled(Texture* tex, SDL_Renderer* renderer, const char* path,
+                     int w, int h);
 void destroy_tex(Texture* tex);
 void draw_tex(Texture* tex, SDL_Renderer* renderer, int x, int y);
 void scale_tex(Texture* tex, int w, int h);
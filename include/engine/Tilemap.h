@@ -0,0 +1,54 @@
+#pragma once
+
+#include <SDL.h>
+#include "Math.h"
+#include "Texture.h"
+#include "SpriteBatch.h"
+
+#define TILEMAP_CHUNK 16            // tiles per chunk side
+#define TILEMAP_MAX_TILE_KINDS 256  // tile IDs are Uint8, 0 = empty
+
+typedef struct TileChunk
+{
+    Uint8 tiles[TILEMAP_CHUNK * TILEMAP_CHUNK];
+    int used;                       // non-empty tiles; 0 lets draw skip the chunk
+} TileChunk;
+
+typedef struct Tilemap
+{
+    int width;                      // in tiles
+    int height;
+    int chunks_x;
+    int chunks_y;
+
+    float tile_w;
+    float tile_h;
+
+    TileChunk* chunks;              // chunks_x * chunks_y, row-major
+    Texture* tileset[TILEMAP_MAX_TILE_KINDS]; // ID -> art (index 0 unused)
+} Tilemap;
+
+int  tilemap_init(Tilemap* m, int width, int height, float tile_w, float tile_h);
+void tilemap_destroy(Tilemap* m);
+
+void tilemap_set_tileset(Tilemap* m, int id, Texture* tex);
+
+void tilemap_set(Tilemap* m, int tx, int ty, int id);
+int  tilemap_get(const Tilemap* m, int tx, int ty);  // 0 outside the map
+void tilemap_fill_row(Tilemap* m, int ty, int tx0, int tx1, int id);
+
+/* Draw only the chunks overlapping the view, emitting into the batcher */
+void tilemap_draw(Tilemap* m, SpriteBatch* batch, Vec2 cam,
+                  float view_w, float view_h);
+
+/* Draw a tile range with its top-left at the origin — bake helper for
+   RenderCache targets (immediate draws; this runs once per bake) */
+void tilemap_render_region(Tilemap* m, SDL_Renderer* renderer,
+                           int tx0, int ty0, int tx1, int ty1);
+
+/* Move an AABB by vel*dt and resolve against solid (non-zero) tiles,
+   one axis at a time, touching only the tiles along the swept edge.
+   Blocked velocity components are zeroed. Returns 1 when the rect
+   landed on top of a tile this call. */
+int tilemap_collide(Tilemap* m, float* x, float* y, float w, float h,
+                    float* vx, float* vy, float dt);
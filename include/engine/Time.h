@@ -1,6 +1,8 @@
 #pragma once
 #include <SDL.h>
 
+/* Millisecond-granular dt on SDL_GetTicks. Fine for casual use, but
+   at 144+ FPS it alternates 6/7 ms — prefer time_dt_hr below. */
 static inline float time_dt(Uint32* last_ticks)
 {
     Uint32 now = SDL_GetTicks();
@@ -8,3 +10,31 @@ static inline float time_dt(Uint32* last_ticks)
     *last_ticks = now;
     return dt;
 }
+
+/* ============ HIGH-RESOLUTION TIME ============
+   Built on SDL_GetPerformanceCounter; sub-microsecond dt for frame
+   timing and profiler zones. */
+
+Uint64 time_now_ns(void);
+
+/* like time_dt but on the performance counter */
+float time_dt_hr(Uint64* last_counter);
+
+/* Integer-tick accumulator for fixed-step loops: everything stays in
+   performance-counter ticks, so hours-long sessions accumulate zero
+   float drift. */
+typedef struct TickAccum
+{
+    Uint64 last;    // counter at the previous advance
+    Uint64 acc;     // unconsumed counter ticks
+    Uint64 step;    // counter ticks per simulation tick
+} TickAccum;
+
+void tick_accum_init(TickAccum* ta, int tick_hz);
+
+/* Returns how many fixed ticks to simulate now (capped at max_ticks;
+   the excess is dropped so a stall can't snowball). */
+int tick_accum_advance(TickAccum* ta, int max_ticks);
+
+/* fraction of the next tick already elapsed, for render interpolation */
+float tick_accum_alpha(const TickAccum* ta);
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <SDL.h>
+#include "Texture.h"
+#include "SpriteBatch.h"
+#include "RenderQueue.h"
+#include "Camera.h"
+
+/* Split-screen view set: up to 4 cameras, each bound to a screen
+   rect via SDL_RenderSetViewport. Scene code runs ONE traversal:
+   for each object ask viewset_cull for a bitmask of the views that
+   can see it, then viewset_push records the draw into every masked
+   view's command buffer at once. viewset_present replays the
+   buffers sequentially, switching viewport and camera offset per
+   view — so 4-player split screen pays for one scene walk plus the
+   sprites actually visible somewhere, not 4 full passes. */
+
+#define VIEWPORTS_MAX 4
+
+typedef struct Viewport
+{
+    SDL_Rect rect;      // screen region, in window pixels
+    Camera cam;         // view_w/h follow the rect
+
+    RenderCmd* cmds;    // world-space draws visible in this view
+    int count;
+    int cap;
+} Viewport;
+
+typedef struct ViewSet
+{
+    SDL_Renderer* renderer;
+    SpriteBatch* batch;
+    Viewport views[VIEWPORTS_MAX];
+    int count;
+} ViewSet;
+
+int  viewset_init(ViewSet* vs, SDL_Renderer* renderer, SpriteBatch* batch);
+void viewset_destroy(ViewSet* vs);
+
+/* Add a view covering the given screen rect; returns its id or -1.
+   cap <= 0 = default. Steer vs->views[id].cam like any Camera. */
+int  view_add(ViewSet* vs, SDL_Rect rect, int cap);
+
+/* Start-of-frame: clear every view's command buffer. */
+void viewset_begin(ViewSet* vs);
+
+/* The shared cull pass: bit i set when view i can see the AABB. */
+unsigned int viewset_cull(const ViewSet* vs, float x, float y,
+                          float w, float h);
+
+/* Record a world-space draw into every view in mask (usually the
+   result of viewset_cull for the same AABB). */
+void viewset_push(ViewSet* vs, unsigned int mask, Texture* tex,
+                  const SDL_Rect* src, float x, float y, float w, float h);
+void viewset_push_tex(ViewSet* vs, unsigned int mask, Texture* tex,
+                      float x, float y);
+
+/* Replay each view's buffer inside its viewport, in add order;
+   restores the full-window viewport afterwards. */
+void viewset_present(ViewSet* vs);
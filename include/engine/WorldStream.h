@@ -0,0 +1,58 @@
+#pragma once
+
+#include <SDL.h>
+#include "Tilemap.h"
+
+/* Streaming layer over Tilemap: chunks live on disk (one file per
+   chunk, "<dir>/chunk_<cx>_<cy>.bin" holding TILEMAP_CHUNK^2 tile
+   IDs) and a prefetch thread reads the ones within a radius of the
+   camera before they scroll into view. Far chunks are evicted, so
+   resident memory follows the view instead of the world, and the
+   main thread never touches the disk. */
+
+#define WSTREAM_PATH_MAX 256
+#define WSTREAM_MAX_PENDING 64
+
+/* chunk residency states */
+#define WSTREAM_EMPTY 0
+#define WSTREAM_LOADING 1
+#define WSTREAM_RESIDENT 2
+
+typedef struct WorldStreamJob
+{
+    int cx;
+    int cy;
+    Uint8 tiles[TILEMAP_CHUNK * TILEMAP_CHUNK];
+    int found;      // 0 = no file on disk (chunk stays empty)
+} WorldStreamJob;
+
+typedef struct WorldStream
+{
+    Tilemap* map;
+    char dir[WSTREAM_PATH_MAX];
+    int radius;     // prefetch ring around the view, in chunks
+
+    Uint8* state;   // per chunk, WSTREAM_* above
+
+    WorldStreamJob req_ring[WSTREAM_MAX_PENDING];
+    int req_head, req_tail;
+    WorldStreamJob done_ring[WSTREAM_MAX_PENDING];
+    int done_head, done_tail;
+    int in_flight;
+
+    SDL_mutex* lock;
+    SDL_sem* req_sem;
+    SDL_Thread* worker;
+    int running;
+} WorldStream;
+
+int  wstream_init(WorldStream* ws, Tilemap* map, const char* dir, int radius_chunks);
+void wstream_shutdown(WorldStream* ws);
+
+/* Call once per tick: queues prefetches for chunks near the view,
+   applies finished reads to the map, and evicts chunks outside the
+   radius. Never blocks on I/O. */
+void wstream_update(WorldStream* ws, Vec2 cam, float view_w, float view_h);
+
+/* Editor/tooling side: write one chunk of the map to the directory. */
+int wstream_save_chunk(const Tilemap* map, const char* dir, int cx, int cy);
@@ -0,0 +1,262 @@
+#define SDL_MAIN_HANDLED
+#include <stdio.h>
+#include <stdlib.h>
+#include "Global.h"
+
+/* Synthetic workloads for regression-gating engine changes.
+   Runs offscreen (software renderer on a plain surface) so it works
+   headless in CI. Each bench reports ops/sec plus p50/p95/p99 of the
+   per-iteration times. */
+
+#define DRAW_SPRITES 8000
+#define DRAW_FRAMES 100
+#define BROAD_BODIES 2000
+#define LOAD_REPS 20
+
+static double now_ms(void)
+{
+    return (double)SDL_GetPerformanceCounter() * 1000.0 /
+           (double)SDL_GetPerformanceFrequency();
+}
+
+static int cmp_double(const void* a, const void* b)
+{
+    double d = *(const double*)a - *(const double*)b;
+    return (d > 0.0) - (d < 0.0);
+}
+
+static void report(const char* name, double* ms, int n, double ops_per_iter)
+{
+    double total = 0.0;
+    for (int i = 0; i < n; i++) total += ms[i];
+
+    qsort(ms, (size_t)n, sizeof(double), cmp_double);
+
+    double p50 = ms[n / 2];
+    double p95 = ms[(int)(n * 0.95)];
+    double p99 = ms[(int)(n * 0.99)];
+    double ops = total > 0.0 ? ops_per_iter * n / (total / 1000.0) : 0.0;
+
+    printf("%-28s %12.0f ops/s  p50 %8.3f ms  p95 %8.3f ms  p99 %8.3f ms\n",
+           name, ops, p50, p95, p99);
+}
+
+/* throughput of the immediate path vs the batcher, same sprite count */
+static void bench_draw(SDL_Renderer* renderer)
+{
+    Texture tex = (Texture){0};
+    tex.sdl_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                        SDL_TEXTUREACCESS_STATIC, 32, 32);
+    if (!tex.sdl_texture)
+    {
+        printf("bench_draw skipped: %s\n", SDL_GetError());
+        return;
+    }
+
+    tex.width = tex.height = 32;
+    tex.sheet_w = tex.sheet_h = 32;
+    tex.draw_w = tex.draw_h = 32;
+
+    static double ms[DRAW_FRAMES];
+
+    for (int f = 0; f < DRAW_FRAMES; f++)
+    {
+        double t0 = now_ms();
+        for (int i = 0; i < DRAW_SPRITES; i++)
+            draw_tex(&tex, renderer, (i * 7) % 800, (i * 13) % 600);
+        ms[f] = now_ms() - t0;
+    }
+    report("draw_tex x8000", ms, DRAW_FRAMES, DRAW_SPRITES);
+
+    SpriteBatch batch;
+    batch_init(&batch, renderer, 0);
+
+    for (int f = 0; f < DRAW_FRAMES; f++)
+    {
+        double t0 = now_ms();
+        batch_begin(&batch);
+        for (int i = 0; i < DRAW_SPRITES; i++)
+            batch_push_tex(&batch, &tex, (float)((i * 7) % 800), (float)((i * 13) % 600));
+        batch_flush(&batch);
+        ms[f] = now_ms() - t0;
+    }
+    report("batch x8000", ms, DRAW_FRAMES, DRAW_SPRITES);
+
+    batch_destroy(&batch);
+    SDL_DestroyTexture(tex.sdl_texture);
+}
+
+/* per-object entity_update vs the SoA pool, same entity counts */
+static void bench_entities(int n)
+{
+    static Texture frame_a, frame_b;
+    static Texture* anim[2] = { &frame_a, &frame_b };
+
+    Entity* ents = malloc(sizeof(Entity) * (size_t)n);
+    if (!ents) return;
+
+    for (int i = 0; i < n; i++)
+    {
+        entity_init(&ents[i], (float)(i % 800), (float)(i % 600));
+        entity_play_anim(&ents[i], anim, 2, 8.0f);
+    }
+
+    enum { REPS = 50 };
+    static double ms[REPS];
+    char label[64];
+
+    for (int r = 0; r < REPS; r++)
+    {
+        double t0 = now_ms();
+        for (int i = 0; i < n; i++)
+            entity_update(&ents[i], 1.0f / 60.0f);
+        ms[r] = now_ms() - t0;
+    }
+    snprintf(label, sizeof(label), "entity_update x%d", n);
+    report(label, ms, REPS, n);
+    free(ents);
+
+    EntityPool pool;
+    if (!pool_init(&pool, n)) return;
+
+    for (int i = 0; i < n; i++)
+    {
+        EntityId id = pool_spawn(&pool, (float)(i % 800), (float)(i % 600));
+        pool_set_vel(&pool, id, 10.0f, -5.0f);
+        pool_play_anim(&pool, id, anim, 2, 8.0f);
+    }
+
+    for (int r = 0; r < REPS; r++)
+    {
+        double t0 = now_ms();
+        pool_update_all(&pool, 1.0f / 60.0f);
+        ms[r] = now_ms() - t0;
+    }
+    snprintf(label, sizeof(label), "pool_update_all x%d", n);
+    report(label, ms, REPS, n);
+    pool_destroy(&pool);
+}
+
+/* all-pairs rect_overlaps vs grid broad phase at the same body count */
+static void bench_broadphase(void)
+{
+    enum { N = BROAD_BODIES, REPS = 20 };
+
+    static float rx[N], ry[N];
+    static double ms[REPS];
+    static int candidates[N];
+
+    unsigned int seed = 12345;
+    for (int i = 0; i < N; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        rx[i] = (float)(seed % 4000u);
+        seed = seed * 1664525u + 1013904223u;
+        ry[i] = (float)(seed % 4000u);
+    }
+
+    volatile int hits = 0;
+
+    for (int r = 0; r < REPS; r++)
+    {
+        double t0 = now_ms();
+        for (int i = 0; i < N; i++)
+            for (int j = i + 1; j < N; j++)
+                if (rect_overlaps(rx[i], ry[i], 16, 16, rx[j], ry[j], 16, 16))
+                    hits++;
+        ms[r] = now_ms() - t0;
+    }
+    report("brute pairs x2000", ms, REPS, (double)N * (N - 1) / 2.0);
+
+    SpatialGrid grid;
+    if (!grid_init(&grid, 64.0f, 64, 64, N, N * 4))
+        return;
+
+    for (int r = 0; r < REPS; r++)
+    {
+        double t0 = now_ms();
+
+        grid_clear(&grid);
+        for (int i = 0; i < N; i++)
+            grid_insert(&grid, i, rx[i], ry[i], 16, 16);
+
+        for (int i = 0; i < N; i++)
+        {
+            int c = grid_query(&grid, rx[i], ry[i], 16, 16, candidates, N);
+            for (int k = 0; k < c; k++)
+            {
+                int j = candidates[k];
+                if (j > i && rect_overlaps(rx[i], ry[i], 16, 16, rx[j], ry[j], 16, 16))
+                    hits++;
+            }
+        }
+
+        ms[r] = now_ms() - t0;
+    }
+    report("grid pairs x2000", ms, REPS, (double)N * (N - 1) / 2.0);
+
+    grid_destroy(&grid);
+}
+
+static void bench_texload(SDL_Renderer* renderer)
+{
+    const char* path = "res/gfx/ground_grass_1.png";
+    static double ms[LOAD_REPS];
+
+    Texture probe = (Texture){0};
+    if (!load_tex(&probe, renderer, path))
+    {
+        printf("texload skipped: '%s' not found (run from the repo root)\n", path);
+        return;
+    }
+    destroy_tex(&probe);
+
+    for (int r = 0; r < LOAD_REPS; r++)
+    {
+        Texture tex = (Texture){0};
+        double t0 = now_ms();
+        load_tex(&tex, renderer, path);
+        ms[r] = now_ms() - t0;
+        destroy_tex(&tex);
+    }
+
+    report("load_tex", ms, LOAD_REPS, 1);
+}
+
+int main(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    if (SDL_Init(0) != 0)
+    {
+        printf("SDL_Init failed: %s\n", SDL_GetError());
+        return 1;
+    }
+    IMG_Init(IMG_INIT_PNG | IMG_INIT_JPG);
+
+    // offscreen software renderer: no window, runs headless
+    SDL_Surface* target = SDL_CreateRGBSurfaceWithFormat(
+        0, 800, 600, 32, SDL_PIXELFORMAT_RGBA32);
+    SDL_Renderer* renderer = target ? SDL_CreateSoftwareRenderer(target) : NULL;
+
+    if (!renderer)
+    {
+        printf("offscreen renderer failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    printf("SDLite bench\n");
+
+    bench_draw(renderer);
+    bench_entities(1000);
+    bench_entities(10000);
+    bench_entities(100000);
+    bench_broadphase();
+    bench_texload(renderer);
+
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(target);
+    IMG_Quit();
+    SDL_Quit();
+    return 0;
+}
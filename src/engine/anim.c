@@ -0,0 +1,138 @@
+#include "Anim.h"
+#include <stdio.h>
+
+typedef struct AnimClip
+{
+    Texture** frames;
+    int count;
+    float spf;          // seconds per frame, precomputed from fps
+    AnimLoop loop;
+} AnimClip;
+
+static AnimClip clips[ANIM_MAX_CLIPS];
+static int clip_count = 0;
+
+/* instance state: SoA so the bulk update walks memory linearly;
+   dead instances carry clip -1 and skip in one branch */
+static int   inst_clip[ANIM_MAX_INSTANCES];
+static float inst_t[ANIM_MAX_INSTANCES];
+static int   inst_index[ANIM_MAX_INSTANCES];
+static Uint8 inst_done[ANIM_MAX_INSTANCES];
+
+static int free_list[ANIM_MAX_INSTANCES];
+static int free_count = 0;
+static int high = 0;
+
+AnimClipId anim_register_clip(Texture** frames, int count, float fps, AnimLoop loop)
+{
+    if (!frames || count <= 0 || fps <= 0.0f)
+        return -1;
+
+    if (clip_count >= ANIM_MAX_CLIPS)
+    {
+        printf("anim_register_clip: registry full (%d clips)\n", ANIM_MAX_CLIPS);
+        return -1;
+    }
+
+    clips[clip_count].frames = frames;
+    clips[clip_count].count = count;
+    clips[clip_count].spf = 1.0f / fps;
+    clips[clip_count].loop = loop;
+
+    return clip_count++;
+}
+
+AnimInstId anim_spawn(AnimClipId clip)
+{
+    if (clip < 0 || clip >= clip_count)
+        return -1;
+
+    int id;
+    if (free_count > 0)
+        id = free_list[--free_count];
+    else if (high < ANIM_MAX_INSTANCES)
+        id = high++;
+    else
+        return -1;
+
+    inst_clip[id] = clip;
+    inst_t[id] = 0.0f;
+    inst_index[id] = 0;
+    inst_done[id] = 0;
+
+    return id;
+}
+
+void anim_kill(AnimInstId inst)
+{
+    if (inst < 0 || inst >= high || inst_clip[inst] < 0)
+        return;
+
+    inst_clip[inst] = -1;
+    free_list[free_count++] = inst;
+}
+
+void anim_set_clip(AnimInstId inst, AnimClipId clip)
+{
+    // dead instances sit in the free list — setting a clip here would
+    // resurrect a slot anim_spawn can still hand out
+    if (inst < 0 || inst >= high || inst_clip[inst] < 0) return;
+    if (clip < 0 || clip >= clip_count) return;
+
+    // only reset if you're switching to a different clip
+    if (inst_clip[inst] != clip)
+    {
+        inst_clip[inst] = clip;
+        inst_t[inst] = 0.0f;
+        inst_index[inst] = 0;
+        inst_done[inst] = 0;
+    }
+}
+
+int anim_done(AnimInstId inst)
+{
+    if (inst < 0 || inst >= high || inst_clip[inst] < 0)
+        return 0;
+    return inst_done[inst];
+}
+
+Texture* anim_frame(AnimInstId inst)
+{
+    if (inst < 0 || inst >= high || inst_clip[inst] < 0)
+        return NULL;
+    return clips[inst_clip[inst]].frames[inst_index[inst]];
+}
+
+void anim_update_all(float dt)
+{
+    for (int i = 0; i < high; i++)
+    {
+        int c = inst_clip[i];
+        if (c < 0 || inst_done[i])
+            continue;
+
+        const AnimClip* clip = &clips[c];
+
+        inst_t[i] += dt;
+
+        while (inst_t[i] >= clip->spf)
+        {
+            inst_t[i] -= clip->spf;
+            inst_index[i]++;
+
+            if (inst_index[i] >= clip->count)
+            {
+                if (clip->loop == ANIM_LOOP)
+                {
+                    inst_index[i] = 0;
+                }
+                else
+                {
+                    inst_index[i] = clip->count - 1;
+                    inst_done[i] = 1;
+                    break;
+                }
+            }
+        }
+    }
+}
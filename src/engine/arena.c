@@ -0,0 +1,192 @@
+#include "Arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ARENA_ALIGN 16
+
+int arena_init(Arena* a, size_t cap)
+{
+    a->base = malloc(cap);
+    a->cap = cap;
+    a->used = 0;
+    a->high = 0;
+
+    if (!a->base)
+    {
+        printf("arena_init failed: out of memory (%zu bytes)\n", cap);
+        return 0;
+    }
+
+    return 1;
+}
+
+void arena_destroy(Arena* a)
+{
+    free(a->base);
+    a->base = NULL;
+    a->cap = 0;
+    a->used = 0;
+}
+
+void* arena_alloc(Arena* a, size_t size)
+{
+    size_t aligned = (a->used + (ARENA_ALIGN - 1)) & ~(size_t)(ARENA_ALIGN - 1);
+
+    if (!a->base || aligned + size > a->cap)
+        return NULL;
+
+    a->used = aligned + size;
+    if (a->used > a->high)
+        a->high = a->used;
+
+    return a->base + aligned;
+}
+
+void arena_reset(Arena* a)
+{
+    a->used = 0;
+}
+
+/* ---- per-frame scratch ---- */
+
+static Arena scratch;
+
+/* overflow fallbacks kept until end of frame so pointers stay valid;
+   chained through a header so every block is freed no matter how
+   many a frame needs */
+typedef struct ScratchOverflow
+{
+    struct ScratchOverflow* next;
+} ScratchOverflow;
+
+static ScratchOverflow* overflow_head = NULL;
+
+static size_t heap_allocs_now = 0;
+static size_t heap_allocs_last = 0;
+
+int scratch_init(size_t cap)
+{
+    return arena_init(&scratch, cap);
+}
+
+void scratch_shutdown(void)
+{
+    scratch_frame_end();
+    arena_destroy(&scratch);
+}
+
+void* scratch_alloc(size_t size)
+{
+    void* p = arena_alloc(&scratch, size);
+    if (p)
+        return p;
+
+    // keep working when the arena overflows, but make it visible:
+    // this is exactly the malloc-per-frame the counter exists to catch
+    ScratchOverflow* block = malloc(ARENA_ALIGN + size);
+    if (!block)
+        return NULL;
+
+    block->next = overflow_head;
+    overflow_head = block;
+
+    mem_note_heap_alloc();
+    return (unsigned char*)block + ARENA_ALIGN;     // keeps 16-alignment
+}
+
+size_t scratch_high_water(void)
+{
+    return scratch.high;
+}
+
+void scratch_frame_end(void)
+{
+    arena_reset(&scratch);
+
+    while (overflow_head)
+    {
+        ScratchOverflow* next = overflow_head->next;
+        free(overflow_head);
+        overflow_head = next;
+    }
+
+    heap_allocs_last = heap_allocs_now;
+    heap_allocs_now = 0;
+}
+
+/* ---- fixed-size pool ---- */
+
+int mempool_init(MemPool* p, size_t item_size, int cap)
+{
+    // items at least pointer-sized and aligned
+    if (item_size < sizeof(void*))
+        item_size = sizeof(void*);
+    item_size = (item_size + (ARENA_ALIGN - 1)) & ~(size_t)(ARENA_ALIGN - 1);
+
+    p->slots = malloc(item_size * (size_t)cap);
+    p->next_free = malloc(sizeof(int) * (size_t)cap);
+    p->item_size = item_size;
+    p->cap = cap;
+    p->in_use = 0;
+
+    if (!p->slots || !p->next_free)
+    {
+        printf("mempool_init failed: out of memory (%d x %zu bytes)\n",
+               cap, item_size);
+        mempool_destroy(p);
+        return 0;
+    }
+
+    for (int i = 0; i < cap - 1; i++)
+        p->next_free[i] = i + 1;
+    p->next_free[cap - 1] = -1;
+    p->head = 0;
+
+    return 1;
+}
+
+void mempool_destroy(MemPool* p)
+{
+    free(p->slots);
+    free(p->next_free);
+    p->slots = NULL;
+    p->next_free = NULL;
+    p->head = -1;
+    p->in_use = 0;
+}
+
+void* mempool_alloc(MemPool* p)
+{
+    if (p->head < 0)
+        return NULL;
+
+    int slot = p->head;
+    p->head = p->next_free[slot];
+    p->in_use++;
+
+    return p->slots + (size_t)slot * p->item_size;
+}
+
+void mempool_free(MemPool* p, void* item)
+{
+    if (!item)
+        return;
+
+    int slot = (int)(((unsigned char*)item - p->slots) / p->item_size);
+
+    p->next_free[slot] = p->head;
+    p->head = slot;
+    p->in_use--;
+}
+
+/* ---- allocation accounting ---- */
+
+void mem_note_heap_alloc(void)
+{
+    heap_allocs_now++;
+}
+
+size_t mem_frame_heap_allocs(void)
+{
+    return heap_allocs_last;
+}
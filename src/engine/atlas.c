@@ -0,0 +1,174 @@
+#include "Atlas.h"
+#include <SDL_image.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Sheet width used by the runtime packer; grows if an image is wider */
+#define ATLAS_SHEET_W 1024
+#define ATLAS_PAD 1
+
+static void atlas_reset(Atlas* a)
+{
+    a->sheet = (Texture){0};
+    a->count = 0;
+}
+
+static void make_view(Atlas* a, const SDL_Rect* rect, Texture* out)
+{
+    out->sdl_texture = a->sheet.sdl_texture;
+    out->width  = rect->w;
+    out->height = rect->h;
+    out->draw_w = rect->w;
+    out->draw_h = rect->h;
+    out->src = *rect;
+    out->has_src = 1;
+    out->sheet_w = a->sheet.width;
+    out->sheet_h = a->sheet.height;
+}
+
+int atlas_load(Atlas* a, SDL_Renderer* renderer,
+               const char* image_path, const char* desc_path)
+{
+    atlas_reset(a);
+
+    if (!load_tex(&a->sheet, renderer, image_path))
+        return 0;
+
+    FILE* f = fopen(desc_path, "r");
+    if (!f)
+    {
+        printf("atlas_load: cannot open '%s'\n", desc_path);
+        destroy_tex(&a->sheet);
+        return 0;
+    }
+
+    AtlasEntry e;
+    while (a->count < ATLAS_MAX_ENTRIES &&
+           fscanf(f, "%63s %d %d %d %d",
+                  e.name, &e.rect.x, &e.rect.y, &e.rect.w, &e.rect.h) == 5)
+    {
+        a->entries[a->count++] = e;
+    }
+
+    fclose(f);
+    return 1;
+}
+
+int atlas_build(Atlas* a, SDL_Renderer* renderer,
+                const char** paths, int count)
+{
+    atlas_reset(a);
+
+    if (count > ATLAS_MAX_ENTRIES)
+        count = ATLAS_MAX_ENTRIES;
+
+    SDL_Surface* imgs[ATLAS_MAX_ENTRIES];
+    int loaded = 0;
+
+    int sheet_w = ATLAS_SHEET_W;
+    for (int i = 0; i < count; i++)
+    {
+        imgs[i] = IMG_Load(paths[i]);
+        if (!imgs[i])
+        {
+            printf("atlas_build: IMG_Load failed for '%s': %s\n", paths[i], IMG_GetError());
+            goto fail;
+        }
+        loaded++;
+
+        if (imgs[i]->w + ATLAS_PAD * 2 > sheet_w)
+            sheet_w = imgs[i]->w + ATLAS_PAD * 2;
+    }
+
+    // shelf-pack left to right, new shelf when a row fills up
+    int pen_x = ATLAS_PAD;
+    int pen_y = ATLAS_PAD;
+    int shelf_h = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (pen_x + imgs[i]->w + ATLAS_PAD > sheet_w)
+        {
+            pen_x = ATLAS_PAD;
+            pen_y += shelf_h + ATLAS_PAD;
+            shelf_h = 0;
+        }
+
+        AtlasEntry* e = &a->entries[i];
+        strncpy(e->name, paths[i], ATLAS_NAME_MAX - 1);
+        e->name[ATLAS_NAME_MAX - 1] = '\0';
+        e->rect = (SDL_Rect){ pen_x, pen_y, imgs[i]->w, imgs[i]->h };
+
+        pen_x += imgs[i]->w + ATLAS_PAD;
+        if (imgs[i]->h > shelf_h)
+            shelf_h = imgs[i]->h;
+    }
+
+    int sheet_h = pen_y + shelf_h + ATLAS_PAD;
+
+    SDL_Surface* sheet = SDL_CreateRGBSurfaceWithFormat(
+        0, sheet_w, sheet_h, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!sheet)
+    {
+        printf("atlas_build: sheet surface failed: %s\n", SDL_GetError());
+        goto fail;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        // copy pixels verbatim; alpha is baked, not blended
+        SDL_SetSurfaceBlendMode(imgs[i], SDL_BLENDMODE_NONE);
+        SDL_Rect dst = a->entries[i].rect;
+        SDL_BlitSurface(imgs[i], NULL, sheet, &dst);
+    }
+
+    a->sheet.sdl_texture = SDL_CreateTextureFromSurface(renderer, sheet);
+    SDL_FreeSurface(sheet);
+
+    if (!a->sheet.sdl_texture)
+    {
+        printf("atlas_build: SDL_CreateTextureFromSurface failed: %s\n", SDL_GetError());
+        goto fail;
+    }
+
+    a->sheet.width  = sheet_w;
+    a->sheet.height = sheet_h;
+    a->sheet.sheet_w = sheet_w;
+    a->sheet.sheet_h = sheet_h;
+    a->sheet.draw_w = sheet_w;
+    a->sheet.draw_h = sheet_h;
+
+    a->count = count;
+
+    for (int i = 0; i < loaded; i++)
+        SDL_FreeSurface(imgs[i]);
+    return 1;
+
+fail:
+    for (int i = 0; i < loaded; i++)
+        SDL_FreeSurface(imgs[i]);
+    atlas_reset(a);
+    return 0;
+}
+
+int atlas_get(Atlas* a, const char* name, Texture* out)
+{
+    for (int i = 0; i < a->count; i++)
+    {
+        if (strcmp(a->entries[i].name, name) == 0)
+        {
+            make_view(a, &a->entries[i].rect, out);
+            return 1;
+        }
+    }
+
+    printf("atlas_get: no entry named '%s'\n", name);
+    *out = (Texture){0};
+    return 0;
+}
+
+void atlas_destroy(Atlas* a)
+{
+    destroy_tex(&a->sheet);
+    a->count = 0;
+}
@@ -0,0 +1,79 @@
+#include "Camera.h"
+
+void camera_init(Camera* c, float view_w, float view_h)
+{
+    c->pos = vec2(0.0f, 0.0f);
+    c->view_w = view_w;
+    c->view_h = view_h;
+    c->smoothing = 0.0f;
+    c->dead_w = 0.0f;
+    c->dead_h = 0.0f;
+}
+
+void camera_follow(Camera* c, Vec2 target, float dt)
+{
+    // offset of the target from the current view center
+    float dx = target.x - (c->pos.x + c->view_w * 0.5f);
+    float dy = target.y - (c->pos.y + c->view_h * 0.5f);
+
+    float hw = c->dead_w * 0.5f;
+    float hh = c->dead_h * 0.5f;
+
+    // desired top-left: move only enough to pull the target back
+    // inside the dead-zone box
+    float want_x = c->pos.x;
+    float want_y = c->pos.y;
+
+    if (dx >  hw) want_x += dx - hw;
+    if (dx < -hw) want_x += dx + hw;
+    if (dy >  hh) want_y += dy - hh;
+    if (dy < -hh) want_y += dy + hh;
+
+    if (c->smoothing <= 0.0f)
+    {
+        c->pos.x = want_x;
+        c->pos.y = want_y;
+    }
+    else
+    {
+        float k = c->smoothing * dt;
+        if (k > 1.0f) k = 1.0f;
+
+        c->pos.x += (want_x - c->pos.x) * k;
+        c->pos.y += (want_y - c->pos.y) * k;
+    }
+}
+
+void camera_clamp_world(Camera* c, float world_w, float world_h)
+{
+    // if world smaller than view, lock to 0
+    if (world_w <= c->view_w) c->pos.x = 0.0f;
+    if (world_h <= c->view_h) c->pos.y = 0.0f;
+
+    if (c->pos.x < 0.0f) c->pos.x = 0.0f;
+    if (c->pos.y < 0.0f) c->pos.y = 0.0f;
+
+    if (c->pos.x + c->view_w > world_w) c->pos.x = world_w - c->view_w;
+    if (c->pos.y + c->view_h > world_h) c->pos.y = world_h - c->view_h;
+}
+
+void cam_visible_aabb(const Camera* c, float* x, float* y, float* w, float* h)
+{
+    if (x) *x = c->pos.x;
+    if (y) *y = c->pos.y;
+    if (w) *w = c->view_w;
+    if (h) *h = c->view_h;
+}
+
+int cam_cull_rect(const Camera* c, float x, float y, float w, float h)
+{
+    return !(x + w <= c->pos.x ||
+             x >= c->pos.x + c->view_w ||
+             y + h <= c->pos.y ||
+             y >= c->pos.y + c->view_h);
+}
+
+Vec2 camera_apply(const Camera* c, Vec2 world_pos)
+{
+    return vec2(world_pos.x - c->pos.x, world_pos.y - c->pos.y);
+}
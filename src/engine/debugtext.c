@@ -0,0 +1,219 @@
+#include "DebugText.h"
+#include <stdio.h>
+
+/* 3x5 microfont: one Uint16 per glyph, five octal digits = five rows
+   of three pixels (bit 2 = left pixel). Readable enough for debug
+   HUDs at 2x, and the whole font is 84 bytes of data. */
+#define ROWS(r0, r1, r2, r3, r4) \
+    (Uint16)(((r0) << 12) | ((r1) << 9) | ((r2) << 6) | ((r3) << 3) | (r4))
+
+#define GLYPH_W 3
+#define GLYPH_H 5
+#define GLYPH_STRIDE 4  // 1 px gap in the atlas and on screen
+
+enum { GLYPH_SPACE = 36, GLYPH_DOT, GLYPH_MINUS, GLYPH_COLON, GLYPH_PCT, GLYPH_SLASH, GLYPH_COUNT };
+
+static const Uint16 glyphs[GLYPH_COUNT] = {
+    ROWS(07,05,05,05,07),   // 0
+    ROWS(02,06,02,02,07),   // 1
+    ROWS(07,01,07,04,07),   // 2
+    ROWS(07,01,07,01,07),   // 3
+    ROWS(05,05,07,01,01),   // 4
+    ROWS(07,04,07,01,07),   // 5
+    ROWS(07,04,07,05,07),   // 6
+    ROWS(07,01,01,02,02),   // 7
+    ROWS(07,05,07,05,07),   // 8
+    ROWS(07,05,07,01,07),   // 9
+    ROWS(07,05,07,05,05),   // A
+    ROWS(06,05,06,05,06),   // B
+    ROWS(07,04,04,04,07),   // C
+    ROWS(06,05,05,05,06),   // D
+    ROWS(07,04,07,04,07),   // E
+    ROWS(07,04,07,04,04),   // F
+    ROWS(07,04,05,05,07),   // G
+    ROWS(05,05,07,05,05),   // H
+    ROWS(07,02,02,02,07),   // I
+    ROWS(01,01,01,05,07),   // J
+    ROWS(05,05,06,05,05),   // K
+    ROWS(04,04,04,04,07),   // L
+    ROWS(05,07,07,05,05),   // M
+    ROWS(06,05,05,05,05),   // N
+    ROWS(07,05,05,05,07),   // O
+    ROWS(07,05,07,04,04),   // P
+    ROWS(07,05,05,07,01),   // Q
+    ROWS(07,05,06,05,05),   // R
+    ROWS(07,04,07,01,07),   // S
+    ROWS(07,02,02,02,02),   // T
+    ROWS(05,05,05,05,07),   // U
+    ROWS(05,05,05,05,02),   // V
+    ROWS(05,05,07,07,05),   // W
+    ROWS(05,05,02,05,05),   // X
+    ROWS(05,05,02,02,02),   // Y
+    ROWS(07,01,02,04,07),   // Z
+    ROWS(00,00,00,00,00),   // space
+    ROWS(00,00,00,00,02),   // .
+    ROWS(00,00,07,00,00),   // -
+    ROWS(00,02,00,02,00),   // :
+    ROWS(05,01,02,04,05),   // %
+    ROWS(01,01,02,04,04),   // /
+};
+
+static Texture font_tex = {0};
+
+static int glyph_index(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'Z') return 10 + (c - 'A');
+    if (c >= 'a' && c <= 'z') return 10 + (c - 'a');
+
+    switch (c)
+    {
+        case '.': return GLYPH_DOT;
+        case '-': return GLYPH_MINUS;
+        case ':': return GLYPH_COLON;
+        case '%': return GLYPH_PCT;
+        case '/': return GLYPH_SLASH;
+        default:  return GLYPH_SPACE;
+    }
+}
+
+int dtext_init(SDL_Renderer* renderer)
+{
+    if (font_tex.sdl_texture)
+        return 1;
+
+    int w = GLYPH_STRIDE * GLYPH_COUNT;
+    int h = GLYPH_H;
+
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(
+        0, w, h, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!surface)
+    {
+        printf("dtext_init: surface failed: %s\n", SDL_GetError());
+        return 0;
+    }
+
+    Uint32 white = SDL_MapRGBA(surface->format, 255, 255, 255, 255);
+    Uint32* pixels = surface->pixels;
+    int pitch = surface->pitch / 4;
+
+    for (int g = 0; g < GLYPH_COUNT; g++)
+        for (int row = 0; row < GLYPH_H; row++)
+            for (int col = 0; col < GLYPH_W; col++)
+                if (glyphs[g] & (1 << ((GLYPH_H - 1 - row) * 3 + (GLYPH_W - 1 - col))))
+                    pixels[row * pitch + g * GLYPH_STRIDE + col] = white;
+
+    font_tex.sdl_texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+
+    if (!font_tex.sdl_texture)
+    {
+        printf("dtext_init: SDL_CreateTextureFromSurface failed: %s\n", SDL_GetError());
+        return 0;
+    }
+
+    font_tex.width = w;
+    font_tex.height = h;
+    font_tex.sheet_w = w;
+    font_tex.sheet_h = h;
+    font_tex.draw_w = w;
+    font_tex.draw_h = h;
+
+    return 1;
+}
+
+void dtext_shutdown(void)
+{
+    destroy_tex(&font_tex);
+    font_tex = (Texture){0};
+}
+
+void dtext_draw(SpriteBatch* batch, const char* s, float x, float y, int scale)
+{
+    if (!font_tex.sdl_texture || scale <= 0)
+        return;
+
+    float pen = x;
+
+    for (; *s; s++)
+    {
+        int g = glyph_index(*s);
+
+        if (g != GLYPH_SPACE)
+        {
+            SDL_Rect src = { g * GLYPH_STRIDE, 0, GLYPH_W, GLYPH_H };
+            batch_push(batch, &font_tex, &src, pen, y,
+                       (float)(GLYPH_W * scale), (float)(GLYPH_H * scale));
+        }
+
+        pen += (float)(GLYPH_STRIDE * scale);
+    }
+}
+
+void dtext_draw_int(SpriteBatch* batch, long v, float x, float y, int scale)
+{
+    char buf[24];
+    int i = sizeof(buf) - 1;
+
+    buf[i] = '\0';
+
+    unsigned long u = v < 0 ? (unsigned long)(-v) : (unsigned long)v;
+    do
+    {
+        buf[--i] = (char)('0' + (u % 10));
+        u /= 10;
+    } while (u && i > 1);
+
+    if (v < 0)
+        buf[--i] = '-';
+
+    dtext_draw(batch, buf + i, x, y, scale);
+}
+
+void dtext_draw_float(SpriteBatch* batch, float v, int decimals,
+                      float x, float y, int scale)
+{
+    if (decimals < 0) decimals = 0;
+    if (decimals > 6) decimals = 6;
+
+    long pow10 = 1;
+    for (int i = 0; i < decimals; i++)
+        pow10 *= 10;
+
+    float a = v < 0.0f ? -v : v;
+    long scaled = (long)(a * (float)pow10 + 0.5f);
+
+    long whole = scaled / pow10;
+    long frac = scaled % pow10;
+
+    float pen = x;
+
+    if (v < 0.0f)
+    {
+        dtext_draw(batch, "-", pen, y, scale);
+        pen += (float)(GLYPH_STRIDE * scale);
+    }
+
+    dtext_draw_int(batch, whole, pen, y, scale);
+
+    if (decimals > 0)
+    {
+        // advance past the whole part
+        long w = whole;
+        int digits = 1;
+        while (w >= 10) { w /= 10; digits++; }
+        pen += (float)(GLYPH_STRIDE * scale * digits);
+
+        dtext_draw(batch, ".", pen, y, scale);
+        pen += (float)(GLYPH_STRIDE * scale);
+
+        // leading zeros in the fraction
+        for (long p = pow10 / 10; p > 1 && frac < p; p /= 10)
+        {
+            dtext_draw(batch, "0", pen, y, scale);
+            pen += (float)(GLYPH_STRIDE * scale);
+        }
+
+        dtext_draw_int(batch, frac, pen, y, scale);
+    }
+}
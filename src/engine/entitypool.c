@@ -0,0 +1,203 @@
+#include "EntityPool.h"
+#include "Jobs.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+int pool_init(EntityPool* p, int capacity)
+{
+    size_t n = (size_t)capacity;
+
+    p->capacity = capacity;
+    p->high = 0;
+    p->alive_count = 0;
+    p->free_count = 0;
+
+    p->pos_x = calloc(n, sizeof(float));
+    p->pos_y = calloc(n, sizeof(float));
+    p->vel_x = calloc(n, sizeof(float));
+    p->vel_y = calloc(n, sizeof(float));
+
+    p->frames     = calloc(n, sizeof(Texture**));
+    p->anim_count = calloc(n, sizeof(int));
+    p->anim_fps   = calloc(n, sizeof(float));
+    p->anim_t     = calloc(n, sizeof(float));
+    p->anim_index = calloc(n, sizeof(int));
+
+    p->tex   = calloc(n, sizeof(Texture*));
+    p->alive = calloc(n, sizeof(Uint8));
+    p->free_list = calloc(n, sizeof(int));
+
+    if (!p->pos_x || !p->pos_y || !p->vel_x || !p->vel_y ||
+        !p->frames || !p->anim_count || !p->anim_fps ||
+        !p->anim_t || !p->anim_index ||
+        !p->tex || !p->alive || !p->free_list)
+    {
+        printf("pool_init failed: out of memory for %d entities\n", capacity);
+        pool_destroy(p);
+        return 0;
+    }
+
+    return 1;
+}
+
+void pool_destroy(EntityPool* p)
+{
+    free(p->pos_x);     free(p->pos_y);
+    free(p->vel_x);     free(p->vel_y);
+    free(p->frames);    free(p->anim_count);
+    free(p->anim_fps);  free(p->anim_t);
+    free(p->anim_index);
+    free(p->tex);       free(p->alive);
+    free(p->free_list);
+
+    p->pos_x = p->pos_y = p->vel_x = p->vel_y = NULL;
+    p->anim_fps = p->anim_t = NULL;
+    p->anim_count = p->anim_index = p->free_list = NULL;
+    p->frames = NULL;
+    p->tex = NULL;
+    p->alive = NULL;
+    p->capacity = p->high = p->alive_count = p->free_count = 0;
+}
+
+EntityId pool_spawn(EntityPool* p, float x, float y)
+{
+    int id;
+
+    if (p->free_count > 0)
+        id = p->free_list[--p->free_count];
+    else if (p->high < p->capacity)
+        id = p->high++;
+    else
+        return -1;
+
+    p->pos_x[id] = x;
+    p->pos_y[id] = y;
+    p->vel_x[id] = 0.0f;
+    p->vel_y[id] = 0.0f;
+
+    p->frames[id] = NULL;
+    p->anim_count[id] = 0;
+    p->anim_fps[id] = 0.0f;
+    p->anim_t[id] = 0.0f;
+    p->anim_index[id] = 0;
+
+    p->tex[id] = NULL;
+    p->alive[id] = 1;
+    p->alive_count++;
+
+    return id;
+}
+
+void pool_kill(EntityPool* p, EntityId id)
+{
+    if (id < 0 || id >= p->high || !p->alive[id]) return;
+
+    p->alive[id] = 0;
+    p->alive_count--;
+
+    // zero motion so the branch-free integrate pass leaves dead slots alone
+    p->vel_x[id] = 0.0f;
+    p->vel_y[id] = 0.0f;
+    p->anim_count[id] = 0;
+    p->tex[id] = NULL;
+
+    p->free_list[p->free_count++] = id;
+}
+
+void pool_set_vel(EntityPool* p, EntityId id, float vx, float vy)
+{
+    if (id < 0 || id >= p->high) return;
+    p->vel_x[id] = vx;
+    p->vel_y[id] = vy;
+}
+
+void pool_set_tex(EntityPool* p, EntityId id, Texture* tex)
+{
+    if (id < 0 || id >= p->high) return;
+    p->tex[id] = tex;
+    p->frames[id] = NULL;
+    p->anim_count[id] = 0;
+}
+
+void pool_play_anim(EntityPool* p, EntityId id, Texture** frames, int count, float fps)
+{
+    if (id < 0 || id >= p->high) return;
+    if (!frames || count <= 0 || fps <= 0.0f) return;
+
+    // only reset if you're switching to a different anim
+    if (p->frames[id] != frames || p->anim_count[id] != count || p->anim_fps[id] != fps)
+    {
+        p->frames[id] = frames;
+        p->anim_count[id] = count;
+        p->anim_fps[id] = fps;
+        p->anim_t[id] = 0.0f;
+        p->anim_index[id] = 0;
+    }
+
+    p->tex[id] = frames[p->anim_index[id]];
+}
+
+static void pool_update_range(EntityPool* p, float dt, int begin, int end)
+{
+    // integrate: straight linear passes; dead slots have zero velocity
+    float* px = p->pos_x;
+    float* py = p->pos_y;
+    const float* vx = p->vel_x;
+    const float* vy = p->vel_y;
+
+    vec2_scale_add_n(px + begin, vx + begin, dt, end - begin);
+    vec2_scale_add_n(py + begin, vy + begin, dt, end - begin);
+
+    // advance animations
+    for (int i = begin; i < end; i++)
+    {
+        if (p->anim_count[i] <= 0) continue;
+
+        p->anim_t[i] += dt;
+
+        float spf = 1.0f / p->anim_fps[i];
+        while (p->anim_t[i] >= spf)
+        {
+            p->anim_t[i] -= spf;
+            p->anim_index[i]++;
+            if (p->anim_index[i] >= p->anim_count[i])
+                p->anim_index[i] = 0;
+        }
+
+        p->tex[i] = p->frames[i][p->anim_index[i]];
+    }
+}
+
+void pool_update_all(EntityPool* p, float dt)
+{
+    pool_update_range(p, dt, 0, p->high);
+}
+
+typedef struct PoolUpdateJob
+{
+    EntityPool* p;
+    float dt;
+} PoolUpdateJob;
+
+static void pool_update_job(int begin, int end, void* user)
+{
+    PoolUpdateJob* j = user;
+    pool_update_range(j->p, j->dt, begin, end);
+}
+
+void pool_update_all_parallel(EntityPool* p, float dt)
+{
+    PoolUpdateJob job = { p, dt };
+
+    // slots are independent, so any partition of [0, high) is safe
+    job_parallel_for(p->high, 4096, pool_update_job, &job);
+}
+
+void pool_draw_all(EntityPool* p, SpriteBatch* batch, Vec2 cam)
+{
+    for (int i = 0; i < p->high; i++)
+    {
+        if (!p->alive[i] || !p->tex[i]) continue;
+        batch_push_tex(batch, p->tex[i], p->pos_x[i] - cam.x, p->pos_y[i] - cam.y);
+    }
+}
@@ -0,0 +1,67 @@
+#include "GameLoop.h"
+#include "Input.h"
+#include "Replay.h"
+#include "Time.h"
+
+static int loop_running = 0;
+
+void engine_loop_stop(void)
+{
+    loop_running = 0;
+}
+
+void engine_loop(EngineUpdateFn update, EngineRenderFn render,
+                 int tick_hz, void* user)
+{
+    if (tick_hz <= 0)
+        tick_hz = 60;
+
+    const float tick_dt = 1.0f / (float)tick_hz;
+    const int max_ticks = tick_hz / 4 + 1;  // cap stall catch-up at ~250 ms
+
+    TickAccum ta;
+    tick_accum_init(&ta, tick_hz);
+
+    loop_running = 1;
+    while (loop_running)
+    {
+        input_new_frame();
+
+        SDL_Event e;
+        while (SDL_PollEvent(&e))
+        {
+            if (e.type == SDL_QUIT) loop_running = 0;
+            input_process_event(&e);
+            replay_record_event(&e);    // no-op unless a recording is open
+        }
+
+        int ticks = tick_accum_advance(&ta, max_ticks);
+        for (int i = 0; i < ticks; i++)
+        {
+            update(tick_dt, user);
+            replay_record_tick();
+        }
+        replay_record_frame();  // edge flags clear per frame, so
+                                // playback must group ticks the same way
+
+        render(tick_accum_alpha(&ta), user);
+    }
+}
+
+long engine_run_ticks(EngineUpdateFn update, int tick_hz, long ticks,
+                      void* user)
+{
+    if (tick_hz <= 0)
+        tick_hz = 60;
+
+    const float tick_dt = 1.0f / (float)tick_hz;
+
+    loop_running = 1;
+
+    long i = 0;
+    for (; i < ticks && loop_running; i++)
+        update(tick_dt, user);
+
+    loop_running = 0;
+    return i;
+}
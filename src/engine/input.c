@@ -1,62 +1,132 @@
 #include "Input.h"
-#include <string.h>
 
-static Uint8 curr_keys[SDL_NUM_SCANCODES];
-static Uint8 prev_keys[SDL_NUM_SCANCODES];
+static Uint8 key_down[SDL_NUM_SCANCODES];
+static Uint8 key_pressed[SDL_NUM_SCANCODES];
+static Uint8 key_released[SDL_NUM_SCANCODES];
 
-static Uint32 curr_mouse = 0;
-static Uint32 prev_mouse = 0;
+/* keys whose edge flags are set this frame; cleared one by one at the
+   frame boundary instead of wiping the whole array */
+#define INPUT_MAX_DIRTY 64
+static int dirty[INPUT_MAX_DIRTY];
+static int dirty_count = 0;
+static int dirty_overflow = 0;  // list full: fall back to a full wipe
+
+#define MOUSE_BUTTONS 6
+static Uint8 mouse_down[MOUSE_BUTTONS];
+static Uint8 mouse_pressed[MOUSE_BUTTONS];
+static Uint8 mouse_released[MOUSE_BUTTONS];
 
 static int mouse_x = 0;
 static int mouse_y = 0;
 
-void UpdateInput(void)
+static void mark_dirty(int scancode)
+{
+    if (dirty_count < INPUT_MAX_DIRTY)
+        dirty[dirty_count++] = scancode;
+    else
+        dirty_overflow = 1;     // dropping entries would leave edges stuck
+}
+
+void input_new_frame(void)
+{
+    if (dirty_overflow)
+    {
+        SDL_memset(key_pressed, 0, sizeof(key_pressed));
+        SDL_memset(key_released, 0, sizeof(key_released));
+        dirty_overflow = 0;
+    }
+    else
+    {
+        for (int i = 0; i < dirty_count; i++)
+        {
+            key_pressed[dirty[i]] = 0;
+            key_released[dirty[i]] = 0;
+        }
+    }
+    dirty_count = 0;
+
+    for (int b = 0; b < MOUSE_BUTTONS; b++)
+    {
+        mouse_pressed[b] = 0;
+        mouse_released[b] = 0;
+    }
+}
+
+void input_process_event(const SDL_Event* e)
 {
-    // Save previous state
-    memcpy(prev_keys, curr_keys, sizeof(curr_keys));
-    prev_mouse = curr_mouse;
+    switch (e->type)
+    {
+        case SDL_KEYDOWN:
+            if (e->key.repeat) break;
+            key_down[e->key.keysym.scancode] = 1;
+            key_pressed[e->key.keysym.scancode] = 1;
+            mark_dirty(e->key.keysym.scancode);
+            break;
+
+        case SDL_KEYUP:
+            key_down[e->key.keysym.scancode] = 0;
+            key_released[e->key.keysym.scancode] = 1;
+            mark_dirty(e->key.keysym.scancode);
+            break;
+
+        case SDL_MOUSEBUTTONDOWN:
+            if (e->button.button < MOUSE_BUTTONS)
+            {
+                mouse_down[e->button.button] = 1;
+                mouse_pressed[e->button.button] = 1;
+            }
+            mouse_x = e->button.x;
+            mouse_y = e->button.y;
+            break;
 
-    // Make sure SDL updates input state
-    SDL_PumpEvents();
+        case SDL_MOUSEBUTTONUP:
+            if (e->button.button < MOUSE_BUTTONS)
+            {
+                mouse_down[e->button.button] = 0;
+                mouse_released[e->button.button] = 1;
+            }
+            mouse_x = e->button.x;
+            mouse_y = e->button.y;
+            break;
 
-    // Get keyboard
-    const Uint8* state = SDL_GetKeyboardState(NULL);
-    memcpy(curr_keys, state, sizeof(curr_keys));
+        case SDL_MOUSEMOTION:
+            mouse_x = e->motion.x;
+            mouse_y = e->motion.y;
+            break;
 
-    // Get mouse
-    curr_mouse = SDL_GetMouseState(&mouse_x, &mouse_y);
+        default:
+            break;
+    }
 }
 
 int IsKeyDown(SDL_Scancode key)
 {
-    return curr_keys[key];
+    return key_down[key];
 }
 
 int IsKeyPressed(SDL_Scancode key)
 {
-    return curr_keys[key] && !prev_keys[key];
+    return key_pressed[key];
 }
 
 int IsKeyReleased(SDL_Scancode key)
 {
-    return !curr_keys[key] && prev_keys[key];
+    return key_released[key];
 }
 
 int IsMouseDown(Uint8 button)
 {
-    return (curr_mouse & SDL_BUTTON(button)) != 0;
+    return button < MOUSE_BUTTONS ? mouse_down[button] : 0;
 }
 
 int IsMousePressed(Uint8 button)
 {
-    Uint32 mask = SDL_BUTTON(button);
-    return (curr_mouse & mask) && !(prev_mouse & mask);
+    return button < MOUSE_BUTTONS ? mouse_pressed[button] : 0;
 }
 
 int IsMouseReleased(Uint8 button)
 {
-    Uint32 mask = SDL_BUTTON(button);
-    return !(curr_mouse & mask) && (prev_mouse & mask);
+    return button < MOUSE_BUTTONS ? mouse_released[button] : 0;
 }
 
 void GetMousePos(int* x, int* y)
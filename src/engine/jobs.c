@@ -0,0 +1,181 @@
+#include "Jobs.h"
+#include <stdio.h>
+
+#define JOBS_MAX_WORKERS 15
+
+static SDL_Thread* workers[JOBS_MAX_WORKERS];
+static int worker_count = 0;
+static int running = 0;
+
+static SDL_sem* work_sem = NULL;   // posted once per worker per job
+static SDL_sem* done_sem = NULL;   // posted once when the last chunk finishes
+
+/* the one job in flight (job_parallel_for blocks until it completes) */
+static JobRangeFn job_fn = NULL;
+static void* job_user = NULL;
+static int job_count = 0;
+static int job_chunk = 0;
+static SDL_atomic_t job_cursor;
+static SDL_atomic_t job_chunks_left;
+static SDL_atomic_t job_open;       // 1 while the published job may be grabbed
+static SDL_atomic_t job_workers_in; // threads currently inside run_chunks
+
+static void run_chunks(void)
+{
+    SDL_AtomicAdd(&job_workers_in, 1);
+
+    for (;;)
+    {
+        // closed for republish: bail out BEFORE touching the cursor,
+        // so a straggler can never grab or decrement the next job
+        if (!SDL_AtomicGet(&job_open))
+            break;
+
+        int begin = SDL_AtomicAdd(&job_cursor, job_chunk);
+        if (begin >= job_count)
+            break;
+
+        int end = begin + job_chunk;
+        if (end > job_count)
+            end = job_count;
+
+        job_fn(begin, end, job_user);
+
+        // previous value 1 means this was the last chunk
+        if (SDL_AtomicAdd(&job_chunks_left, -1) == 1)
+            SDL_SemPost(done_sem);
+    }
+
+    SDL_AtomicAdd(&job_workers_in, -1);
+}
+
+static int jobs_thread(void* data)
+{
+    (void)data;
+
+    for (;;)
+    {
+        SDL_SemWait(work_sem);
+        if (!running)
+            break;
+        run_chunks();
+    }
+
+    return 0;
+}
+
+int jobs_init(int count)
+{
+    if (running)
+        return 1;
+
+    if (count <= 0)
+        count = SDL_GetCPUCount() - 1;   // leave a core for the main thread
+    if (count < 1)
+        count = 1;
+    if (count > JOBS_MAX_WORKERS)
+        count = JOBS_MAX_WORKERS;
+
+    work_sem = SDL_CreateSemaphore(0);
+    done_sem = SDL_CreateSemaphore(0);
+
+    if (!work_sem || !done_sem)
+    {
+        printf("jobs_init failed: %s\n", SDL_GetError());
+        jobs_shutdown();
+        return 0;
+    }
+
+    running = 1;
+    worker_count = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        char name[16];
+        snprintf(name, sizeof(name), "job%d", i);
+
+        workers[i] = SDL_CreateThread(jobs_thread, name, NULL);
+        if (!workers[i])
+        {
+            printf("jobs_init: SDL_CreateThread failed: %s\n", SDL_GetError());
+            break;
+        }
+        worker_count++;
+    }
+
+    if (worker_count == 0)
+    {
+        jobs_shutdown();
+        return 0;
+    }
+
+    return 1;
+}
+
+void jobs_shutdown(void)
+{
+    if (worker_count > 0)
+    {
+        running = 0;
+        for (int i = 0; i < worker_count; i++)
+            SDL_SemPost(work_sem);
+        for (int i = 0; i < worker_count; i++)
+            SDL_WaitThread(workers[i], NULL);
+        worker_count = 0;
+    }
+
+    if (work_sem) { SDL_DestroySemaphore(work_sem); work_sem = NULL; }
+    if (done_sem) { SDL_DestroySemaphore(done_sem); done_sem = NULL; }
+    running = 0;
+}
+
+int jobs_worker_count(void)
+{
+    return worker_count;
+}
+
+void job_parallel_for(int count, int chunk, JobRangeFn fn, void* user)
+{
+    if (count <= 0 || !fn)
+        return;
+
+    if (chunk <= 0)
+        chunk = 1;
+
+    // no pool (or job too small to be worth the wakeups): run inline
+    if (!running || count <= chunk)
+    {
+        fn(0, count, user);
+        return;
+    }
+
+    /* Quiesce, then publish. Write ordering alone can't make this
+       safe: a straggler still looping in run_chunks from the last
+       job races its cursor fetch against every publish order, and
+       its plain job_chunk/job_count reads would be unsynchronized
+       with the new values — double-run ranges, early done posts, or
+       a counter that never reaches zero. So the job is closed first
+       (run_chunks checks job_open before every grab and bails), then
+       we wait for the straggler count to hit zero — they only have
+       instructions left at this point, not chunks — and only then
+       write the job state and reopen. Workers read fields strictly
+       after observing job_open, and SDL atomics are full barriers. */
+    SDL_AtomicSet(&job_open, 0);
+    while (SDL_AtomicGet(&job_workers_in) != 0)
+        ;
+    job_fn = fn;
+    job_user = user;
+    job_count = count;
+    job_chunk = chunk;
+    SDL_AtomicSet(&job_chunks_left, (count + chunk - 1) / chunk);
+    SDL_AtomicSet(&job_cursor, 0);
+    SDL_AtomicSet(&job_open, 1);
+
+    for (int i = 0; i < worker_count; i++)
+        SDL_SemPost(work_sem);
+
+    // the calling thread pulls chunks too instead of just waiting
+    run_chunks();
+
+    SDL_SemWait(done_sem);
+}
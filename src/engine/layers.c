@@ -0,0 +1,205 @@
+#include "Layers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LAYER_DEFAULT_CAP 1024
+
+int layers_init(LayerCompositor* lc, SDL_Renderer* renderer, SpriteBatch* batch)
+{
+    memset(lc, 0, sizeof(*lc));
+    lc->renderer = renderer;
+    lc->batch = batch;
+    return 1;
+}
+
+void layers_destroy(LayerCompositor* lc)
+{
+    for (int i = 0; i < lc->count; i++)
+    {
+        free(lc->layers[i].cmds);
+        if (lc->layers[i].is_static)
+            rcache_destroy(&lc->layers[i].cache);
+    }
+    lc->count = 0;
+}
+
+static int layer_alloc(LayerCompositor* lc, const char* name, int z,
+                       float parallax, int cap)
+{
+    if (lc->count >= LAYERS_MAX)
+    {
+        printf("layer_add: out of layers (%s)\n", name);
+        return -1;
+    }
+
+    if (cap <= 0)
+        cap = LAYER_DEFAULT_CAP;
+
+    Layer* l = &lc->layers[lc->count];
+    memset(l, 0, sizeof(*l));
+
+    l->cmds = malloc(sizeof(RenderCmd) * (size_t)cap);
+    if (!l->cmds)
+    {
+        printf("layer_add failed: out of memory (%s, %d commands)\n", name, cap);
+        return -1;
+    }
+
+    SDL_strlcpy(l->name, name, sizeof(l->name));
+    l->z = z;
+    l->parallax = parallax;
+    l->cap = cap;
+    l->batch = lc->batch;
+
+    return lc->count++;
+}
+
+int layer_add(LayerCompositor* lc, const char* name, int z, float parallax,
+              int cap)
+{
+    return layer_alloc(lc, name, z, parallax, cap);
+}
+
+int layer_add_static(LayerCompositor* lc, const char* name, int z,
+                     float parallax, int cap,
+                     float world_x, float world_y, int w, int h)
+{
+    int id = layer_alloc(lc, name, z, parallax, cap);
+    if (id < 0)
+        return -1;
+
+    Layer* l = &lc->layers[id];
+    if (!rcache_init(&l->cache, lc->renderer, world_x, world_y, w, h))
+    {
+        free(l->cmds);
+        lc->count--;
+        return -1;
+    }
+
+    l->is_static = 1;
+    return id;
+}
+
+int layer_find(const LayerCompositor* lc, const char* name)
+{
+    for (int i = 0; i < lc->count; i++)
+        if (strcmp(lc->layers[i].name, name) == 0)
+            return i;
+    return -1;
+}
+
+void layer_push(LayerCompositor* lc, int id, Texture* tex, const SDL_Rect* src,
+                float x, float y, float w, float h)
+{
+    if (id < 0 || id >= lc->count) return;
+
+    Layer* l = &lc->layers[id];
+    if (l->count >= l->cap) return;
+
+    RenderCmd* c = &l->cmds[l->count++];
+    c->tex = tex;
+    if (src)
+    {
+        c->src = *src;
+        c->has_src = 1;
+    }
+    else
+    {
+        c->has_src = 0;
+    }
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    c->z = 0;   // ordering lives on the layer
+
+    if (l->is_static)
+        rcache_invalidate(&l->cache);
+}
+
+void layer_push_tex(LayerCompositor* lc, int id, Texture* tex, float x, float y)
+{
+    layer_push(lc, id, tex, NULL, x, y,
+               (float)tex->draw_w, (float)tex->draw_h);
+}
+
+void layer_invalidate(LayerCompositor* lc, int id)
+{
+    if (id < 0 || id >= lc->count) return;
+    if (lc->layers[id].is_static)
+        rcache_invalidate(&lc->layers[id].cache);
+}
+
+void layers_begin(LayerCompositor* lc)
+{
+    for (int i = 0; i < lc->count; i++)
+        if (!lc->layers[i].is_static)
+            lc->layers[i].count = 0;
+}
+
+/* Bake callback for static layers: replay the layer's commands with
+   the cache region's top-left at (0,0). */
+static void layer_bake(SDL_Renderer* renderer, void* user)
+{
+    (void)renderer;
+    Layer* l = user;
+
+    batch_begin(l->batch);
+    for (int i = 0; i < l->count; i++)
+    {
+        RenderCmd* c = &l->cmds[i];
+        batch_push(l->batch, c->tex, c->has_src ? &c->src : NULL,
+                   c->x - l->cache.world_x, c->y - l->cache.world_y,
+                   c->w, c->h);
+    }
+    batch_flush(l->batch);
+}
+
+void layers_composite(LayerCompositor* lc, const Camera* cam)
+{
+    // sort a small index array by z (stable for equal z)
+    int order[LAYERS_MAX];
+    for (int i = 0; i < lc->count; i++)
+    {
+        int j = i;
+        while (j > 0 && lc->layers[order[j - 1]].z > lc->layers[i].z)
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    for (int i = 0; i < lc->count; i++)
+    {
+        Layer* l = &lc->layers[order[i]];
+
+        float off_x = cam->pos.x * l->parallax;
+        float off_y = cam->pos.y * l->parallax;
+
+        if (l->is_static)
+        {
+            // one RenderCopy; re-bakes through the batcher when dirty
+            rcache_draw(&l->cache, lc->renderer, vec2(off_x, off_y),
+                        layer_bake, l);
+            continue;
+        }
+
+        batch_begin(lc->batch);
+        for (int k = 0; k < l->count; k++)
+        {
+            RenderCmd* c = &l->cmds[k];
+            float sx = c->x - off_x;
+            float sy = c->y - off_y;
+
+            if (sx + c->w < 0.0f || sx > cam->view_w ||
+                sy + c->h < 0.0f || sy > cam->view_h)
+                continue;
+
+            batch_push(lc->batch, c->tex, c->has_src ? &c->src : NULL,
+                       sx, sy, c->w, c->h);
+        }
+        batch_flush(lc->batch);
+    }
+}
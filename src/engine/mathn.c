@@ -0,0 +1,75 @@
+#include "Math.h"
+
+#if defined(__SSE__) || defined(__SSE2__) || defined(_M_X64)
+  #define MATHN_SSE 1
+  #include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+  #define MATHN_NEON 1
+  #include <arm_neon.h>
+#endif
+
+void vec2_add_n(float* dst, const float* a, const float* b, int n)
+{
+    int i = 0;
+
+#if defined(MATHN_SSE)
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+#elif defined(MATHN_NEON)
+    for (; i + 4 <= n; i += 4)
+        vst1q_f32(dst + i, vaddq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+#endif
+
+    for (; i < n; i++)
+        dst[i] = a[i] + b[i];
+}
+
+void vec2_scale_add_n(float* dst, const float* v, float s, int n)
+{
+    int i = 0;
+
+#if defined(MATHN_SSE)
+    __m128 vs = _mm_set1_ps(s);
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(dst + i,
+                      _mm_add_ps(_mm_loadu_ps(dst + i),
+                                 _mm_mul_ps(_mm_loadu_ps(v + i), vs)));
+#elif defined(MATHN_NEON)
+    float32x4_t vs = vdupq_n_f32(s);
+    for (; i + 4 <= n; i += 4)
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(v + i), vs));
+#endif
+
+    for (; i < n; i++)
+        dst[i] += v[i] * s;
+}
+
+void cam_apply_n(float* dst_x, float* dst_y,
+                 const float* x, const float* y, Vec2 cam, int n)
+{
+    int i = 0;
+
+#if defined(MATHN_SSE)
+    __m128 cx = _mm_set1_ps(cam.x);
+    __m128 cy = _mm_set1_ps(cam.y);
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm_storeu_ps(dst_x + i, _mm_sub_ps(_mm_loadu_ps(x + i), cx));
+        _mm_storeu_ps(dst_y + i, _mm_sub_ps(_mm_loadu_ps(y + i), cy));
+    }
+#elif defined(MATHN_NEON)
+    float32x4_t cx = vdupq_n_f32(cam.x);
+    float32x4_t cy = vdupq_n_f32(cam.y);
+    for (; i + 4 <= n; i += 4)
+    {
+        vst1q_f32(dst_x + i, vsubq_f32(vld1q_f32(x + i), cx));
+        vst1q_f32(dst_y + i, vsubq_f32(vld1q_f32(y + i), cy));
+    }
+#endif
+
+    for (; i < n; i++)
+    {
+        dst_x[i] = x[i] - cam.x;
+        dst_y[i] = y[i] - cam.y;
+    }
+}
@@ -0,0 +1,152 @@
+#include "Pak.h"
+#include <SDL_image.h>
+#include <stdio.h>
+#include <string.h>
+
+#define PAK_MAGIC "SPAK"
+#define PAK_VERSION 1
+#define PAK_HEADER_SIZE 12
+
+#define PAK_FORMAT_RAW 0
+#define PAK_FORMAT_ENCODED 1
+
+int pak_open(Pak* p, const char* path)
+{
+    p->data = NULL;
+    p->size = 0;
+    p->entries = NULL;
+    p->count = 0;
+
+    size_t size = 0;
+    Uint8* data = SDL_LoadFile(path, &size);   // one open, one read
+    if (!data)
+    {
+        printf("pak_open: cannot read '%s': %s\n", path, SDL_GetError());
+        return 0;
+    }
+
+    if (size < PAK_HEADER_SIZE || memcmp(data, PAK_MAGIC, 4) != 0)
+    {
+        printf("pak_open: '%s' is not a .sdlpak bundle\n", path);
+        SDL_free(data);
+        return 0;
+    }
+
+    Uint32 version, count;
+    memcpy(&version, data + 4, 4);
+    memcpy(&count, data + 8, 4);
+
+    if (version != PAK_VERSION)
+    {
+        printf("pak_open: '%s' has version %u, expected %d\n", path, version, PAK_VERSION);
+        SDL_free(data);
+        return 0;
+    }
+
+    if (size < PAK_HEADER_SIZE + (size_t)count * sizeof(PakEntry))
+    {
+        printf("pak_open: '%s' is truncated\n", path);
+        SDL_free(data);
+        return 0;
+    }
+
+    p->data = data;
+    p->size = size;
+    p->entries = (const PakEntry*)(data + PAK_HEADER_SIZE);
+    p->count = (int)count;
+
+    return 1;
+}
+
+void pak_close(Pak* p)
+{
+    SDL_free(p->data);
+    p->data = NULL;
+    p->size = 0;
+    p->entries = NULL;
+    p->count = 0;
+}
+
+const PakEntry* pak_find(const Pak* p, const char* name)
+{
+    for (int i = 0; i < p->count; i++)
+        if (strncmp(p->entries[i].name, name, PAK_NAME_MAX) == 0)
+            return &p->entries[i];
+    return NULL;
+}
+
+int pak_load_tex(Pak* p, SDL_Renderer* renderer, const char* name, Texture* out)
+{
+    *out = (Texture){0};
+
+    const PakEntry* e = pak_find(p, name);
+    if (!e)
+    {
+        printf("pak_load_tex: no entry named '%s'\n", name);
+        return 0;
+    }
+
+    if ((size_t)e->offset + e->size > p->size)
+    {
+        printf("pak_load_tex: entry '%s' lies outside the bundle\n", name);
+        return 0;
+    }
+
+    const Uint8* bytes = p->data + e->offset;
+
+    if (e->format == PAK_FORMAT_RAW)
+    {
+        // the upload reads w*h*4 bytes at pitch w*4 — don't let a
+        // header with inflated dimensions read past the entry
+        if ((Uint64)e->size < (Uint64)e->w * e->h * 4)
+        {
+            printf("pak_load_tex: entry '%s' is smaller than %ux%u RGBA\n",
+                   name, e->w, e->h);
+            return 0;
+        }
+
+        // pre-decoded pixels: straight GPU upload, no inflate
+        out->sdl_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
+                                             SDL_TEXTUREACCESS_STATIC,
+                                             (int)e->w, (int)e->h);
+        if (!out->sdl_texture)
+        {
+            printf("pak_load_tex: SDL_CreateTexture failed: %s\n", SDL_GetError());
+            return 0;
+        }
+
+        SDL_UpdateTexture(out->sdl_texture, NULL, bytes, (int)e->w * 4);
+        SDL_SetTextureBlendMode(out->sdl_texture, SDL_BLENDMODE_BLEND);
+
+        out->width  = (int)e->w;
+        out->height = (int)e->h;
+    }
+    else
+    {
+        // encoded entry: decode from the in-memory slice
+        SDL_Surface* surface = IMG_Load_RW(SDL_RWFromConstMem(bytes, (int)e->size), 1);
+        if (!surface)
+        {
+            printf("pak_load_tex: decode failed for '%s': %s\n", name, IMG_GetError());
+            return 0;
+        }
+
+        out->sdl_texture = SDL_CreateTextureFromSurface(renderer, surface);
+        out->width  = surface->w;
+        out->height = surface->h;
+        SDL_FreeSurface(surface);
+
+        if (!out->sdl_texture)
+        {
+            printf("pak_load_tex: SDL_CreateTextureFromSurface failed: %s\n", SDL_GetError());
+            return 0;
+        }
+    }
+
+    out->sheet_w = out->width;
+    out->sheet_h = out->height;
+    out->draw_w = out->width;
+    out->draw_h = out->height;
+
+    return 1;
+}
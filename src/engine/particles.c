@@ -0,0 +1,144 @@
+#include "Particles.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* small xorshift RNG: cheap, deterministic, no libc state */
+static Uint32 rng_state = 0x12345678u;
+
+static float rng_range(float lo, float hi)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return lo + (hi - lo) * ((float)(rng_state & 0xFFFFFFu) / 16777215.0f);
+}
+
+int particles_init(ParticleSystem* ps, int capacity, Texture* tex)
+{
+    size_t n = (size_t)capacity;
+
+    ps->capacity = capacity;
+    ps->count = 0;
+    ps->tex = tex;
+    ps->gravity = 0.0f;
+
+    ps->pos_x = malloc(n * sizeof(float));
+    ps->pos_y = malloc(n * sizeof(float));
+    ps->vel_x = malloc(n * sizeof(float));
+    ps->vel_y = malloc(n * sizeof(float));
+    ps->life  = malloc(n * sizeof(float));
+    ps->size  = malloc(n * sizeof(float));
+
+    if (!ps->pos_x || !ps->pos_y || !ps->vel_x || !ps->vel_y ||
+        !ps->life || !ps->size)
+    {
+        printf("particles_init failed: out of memory for %d particles\n", capacity);
+        particles_destroy(ps);
+        return 0;
+    }
+
+    return 1;
+}
+
+void particles_destroy(ParticleSystem* ps)
+{
+    free(ps->pos_x); free(ps->pos_y);
+    free(ps->vel_x); free(ps->vel_y);
+    free(ps->life);  free(ps->size);
+
+    ps->pos_x = ps->pos_y = ps->vel_x = ps->vel_y = NULL;
+    ps->life = ps->size = NULL;
+    ps->capacity = ps->count = 0;
+}
+
+void particles_emit(ParticleSystem* ps, int n, float x, float y,
+                    float vel_min_x, float vel_max_x,
+                    float vel_min_y, float vel_max_y,
+                    float life, float size)
+{
+    for (int k = 0; k < n; k++)
+    {
+        if (ps->count >= ps->capacity)
+            return;     // arena full: drop the rest, never grow
+
+        int i = ps->count++;
+
+        ps->pos_x[i] = x;
+        ps->pos_y[i] = y;
+        ps->vel_x[i] = rng_range(vel_min_x, vel_max_x);
+        ps->vel_y[i] = rng_range(vel_min_y, vel_max_y);
+        ps->life[i] = life;
+        ps->size[i] = size;
+    }
+}
+
+void particles_update(ParticleSystem* ps, float dt)
+{
+    int n = ps->count;
+
+    float* px = ps->pos_x;
+    float* py = ps->pos_y;
+    float* vy = ps->vel_y;
+    const float* vx = ps->vel_x;
+    float* life = ps->life;
+
+    float g = ps->gravity * dt;
+
+    // straight array passes; integration goes through the SIMD kernels
+    for (int i = 0; i < n; i++) vy[i] += g;
+    vec2_scale_add_n(px, vx, dt, n);
+    vec2_scale_add_n(py, vy, dt, n);
+    for (int i = 0; i < n; i++) life[i] -= dt;
+
+    // swap-remove expired particles to keep the arrays dense
+    for (int i = 0; i < ps->count; )
+    {
+        if (life[i] > 0.0f)
+        {
+            i++;
+            continue;
+        }
+
+        int last = --ps->count;
+        px[i] = px[last];
+        py[i] = py[last];
+        ps->vel_x[i] = ps->vel_x[last];
+        vy[i] = vy[last];
+        life[i] = life[last];
+        ps->size[i] = ps->size[last];
+    }
+}
+
+void particles_draw(ParticleSystem* ps, SpriteBatch* batch, Vec2 cam)
+{
+    Texture* tex = ps->tex;
+    if (!tex) return;
+
+    const SDL_Rect* src = tex->has_src ? &tex->src : NULL;
+
+    // one texture for the whole system = one geometry submission
+    for (int i = 0; i < ps->count; i++)
+    {
+        float s = ps->size[i];
+        batch_push(batch, tex, src,
+                   ps->pos_x[i] - s * 0.5f - cam.x,
+                   ps->pos_y[i] - s * 0.5f - cam.y,
+                   s, s);
+    }
+}
+
+void emitter_update(ParticleEmitter* e, float dt)
+{
+    e->acc += e->rate * dt;
+
+    int n = (int)e->acc;
+    if (n <= 0)
+        return;
+
+    e->acc -= (float)n;
+
+    particles_emit(e->ps, n, e->x, e->y,
+                   e->vel_min_x, e->vel_max_x,
+                   e->vel_min_y, e->vel_max_y,
+                   e->life, e->size);
+}
@@ -1,4 +1,7 @@
 #include "Physics.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 /* Rect vs rect */
 int rect_overlaps(float ax, float ay, float aw, float ah,
@@ -59,6 +62,431 @@ void rect_bounce_window(float* x, float* y,
     }
 }
 
+/* ============== SWEPT AABB (narrow phase) ============== */
+
+#define SWEEP_NO_TIME 1e30f
+
+int sweep_rect(float ax, float ay, float aw, float ah,
+               float dx, float dy,
+               float bx, float by, float bw, float bh,
+               float* out_t, float* out_nx, float* out_ny)
+{
+    *out_t = 1.0f;
+    *out_nx = 0.0f;
+    *out_ny = 0.0f;
+
+    // entry/exit times per axis (slab test along the motion)
+    float entry_tx, exit_tx;
+    if (dx > 0.0f)
+    {
+        entry_tx = (bx - (ax + aw)) / dx;
+        exit_tx  = ((bx + bw) - ax) / dx;
+    }
+    else if (dx < 0.0f)
+    {
+        entry_tx = ((bx + bw) - ax) / dx;
+        exit_tx  = (bx - (ax + aw)) / dx;
+    }
+    else
+    {
+        if (ax + aw <= bx || ax >= bx + bw) return 0;  // never overlaps on x
+        entry_tx = -SWEEP_NO_TIME;
+        exit_tx  =  SWEEP_NO_TIME;
+    }
+
+    float entry_ty, exit_ty;
+    if (dy > 0.0f)
+    {
+        entry_ty = (by - (ay + ah)) / dy;
+        exit_ty  = ((by + bh) - ay) / dy;
+    }
+    else if (dy < 0.0f)
+    {
+        entry_ty = ((by + bh) - ay) / dy;
+        exit_ty  = (by - (ay + ah)) / dy;
+    }
+    else
+    {
+        if (ay + ah <= by || ay >= by + bh) return 0;  // never overlaps on y
+        entry_ty = -SWEEP_NO_TIME;
+        exit_ty  =  SWEEP_NO_TIME;
+    }
+
+    float entry = entry_tx > entry_ty ? entry_tx : entry_ty;
+    float exit  = exit_tx  < exit_ty  ? exit_tx  : exit_ty;
+
+    // no overlap window inside this motion
+    if (entry > exit || entry < 0.0f || entry > 1.0f)
+        return 0;
+
+    if (entry_tx > entry_ty)
+        *out_nx = dx > 0.0f ? -1.0f : 1.0f;
+    else
+        *out_ny = dy > 0.0f ? -1.0f : 1.0f;
+
+    *out_t = entry;
+    return 1;
+}
+
+int sweep_rect_set(float ax, float ay, float aw, float ah,
+                   float dx, float dy,
+                   const float* rects, int count,
+                   float* out_t, float* out_nx, float* out_ny)
+{
+    int best = -1;
+
+    *out_t = 1.0f;
+    *out_nx = 0.0f;
+    *out_ny = 0.0f;
+
+    for (int i = 0; i < count; i++)
+    {
+        const float* r = rects + i * 4;
+        float t, nx, ny;
+
+        if (sweep_rect(ax, ay, aw, ah, dx, dy, r[0], r[1], r[2], r[3], &t, &nx, &ny) &&
+            t < *out_t)
+        {
+            best = i;
+            *out_t = t;
+            *out_nx = nx;
+            *out_ny = ny;
+        }
+    }
+
+    return best;
+}
+
+void sweep_resolve(float* x, float* y, float w, float h,
+                   float* vx, float* vy, float dt,
+                   const float* rects, int count)
+{
+    // stop a hair short of the surface so the next sweep doesn't
+    // start in penetration
+    const float skin = 0.001f;
+
+    float remaining = dt;
+
+    // at most one contact per axis, plus one slide
+    for (int pass = 0; pass < 3 && remaining > 0.0f; pass++)
+    {
+        float dx = *vx * remaining;
+        float dy = *vy * remaining;
+
+        if (dx == 0.0f && dy == 0.0f)
+            break;
+
+        float t, nx, ny;
+        int hit = sweep_rect_set(*x, *y, w, h, dx, dy, rects, count, &t, &nx, &ny);
+
+        if (hit < 0)
+        {
+            *x += dx;
+            *y += dy;
+            break;
+        }
+
+        *x += dx * t + nx * skin;
+        *y += dy * t + ny * skin;
+
+        // cancel velocity into the surface, keep the tangent (slide)
+        if (nx != 0.0f) *vx = 0.0f;
+        if (ny != 0.0f) *vy = 0.0f;
+
+        remaining *= (1.0f - t);
+    }
+}
+
+/* ============== SPATIAL GRID (broad phase) ============== */
+
+/* world -> cell coordinate, clamped so off-grid objects land in the
+   border cells (coarser, but still correct candidates) */
+static int grid_cell(float v, float cell_size, int limit)
+{
+    int c = (int)(v / cell_size);
+    if (v < 0.0f) c = 0;
+    if (c < 0) c = 0;
+    if (c >= limit) c = limit - 1;
+    return c;
+}
+
+int grid_init(SpatialGrid* g, float cell_size, int cols, int rows,
+              int max_ids, int max_entries)
+{
+    g->cell_size = cell_size;
+    g->cols = cols;
+    g->rows = rows;
+    g->max_ids = max_ids;
+    g->max_entries = max_entries;
+    g->entry_count = 0;
+    g->stamp_now = 0;
+
+    g->heads = malloc(sizeof(int) * (size_t)cols * rows);
+    g->entry_id = malloc(sizeof(int) * (size_t)max_entries);
+    g->entry_next = malloc(sizeof(int) * (size_t)max_entries);
+    g->stamp = calloc((size_t)max_ids, sizeof(unsigned int));
+    g->layer = malloc(sizeof(unsigned int) * (size_t)max_ids);
+
+    if (g->layer)
+        for (int i = 0; i < max_ids; i++)
+            g->layer[i] = 1u;
+
+    if (!g->heads || !g->entry_id || !g->entry_next || !g->stamp || !g->layer)
+    {
+        printf("grid_init failed: out of memory (%dx%d cells, %d entries)\n",
+               cols, rows, max_entries);
+        grid_destroy(g);
+        return 0;
+    }
+
+    grid_clear(g);
+    return 1;
+}
+
+void grid_destroy(SpatialGrid* g)
+{
+    free(g->heads);
+    free(g->entry_id);
+    free(g->entry_next);
+    free(g->stamp);
+    free(g->layer);
+    g->heads = NULL;
+    g->entry_id = NULL;
+    g->entry_next = NULL;
+    g->stamp = NULL;
+    g->layer = NULL;
+    g->entry_count = 0;
+}
+
+void grid_clear(SpatialGrid* g)
+{
+    // -1 is all-ones, so one memset empties every cell
+    memset(g->heads, 0xFF, sizeof(int) * (size_t)g->cols * g->rows);
+    g->entry_count = 0;
+}
+
+void grid_insert(SpatialGrid* g, int id, float x, float y, float w, float h)
+{
+    if (id < 0 || id >= g->max_ids) return;
+
+    int cx0 = grid_cell(x, g->cell_size, g->cols);
+    int cy0 = grid_cell(y, g->cell_size, g->rows);
+    int cx1 = grid_cell(x + w, g->cell_size, g->cols);
+    int cy1 = grid_cell(y + h, g->cell_size, g->rows);
+
+    for (int cy = cy0; cy <= cy1; cy++)
+    {
+        for (int cx = cx0; cx <= cx1; cx++)
+        {
+            if (g->entry_count >= g->max_entries) return;
+
+            int e = g->entry_count++;
+            int cell = cy * g->cols + cx;
+
+            g->entry_id[e] = id;
+            g->entry_next[e] = g->heads[cell];
+            g->heads[cell] = e;
+        }
+    }
+}
+
+int grid_query(SpatialGrid* g, float x, float y, float w, float h,
+               int* out_ids, int max_out)
+{
+    int n = 0;
+
+    // bump the stamp so ids spanning several cells report once
+    g->stamp_now++;
+
+    int cx0 = grid_cell(x, g->cell_size, g->cols);
+    int cy0 = grid_cell(y, g->cell_size, g->rows);
+    int cx1 = grid_cell(x + w, g->cell_size, g->cols);
+    int cy1 = grid_cell(y + h, g->cell_size, g->rows);
+
+    for (int cy = cy0; cy <= cy1; cy++)
+    {
+        for (int cx = cx0; cx <= cx1; cx++)
+        {
+            for (int e = g->heads[cy * g->cols + cx]; e != -1; e = g->entry_next[e])
+            {
+                int id = g->entry_id[e];
+                if (g->stamp[id] == g->stamp_now) continue;
+                g->stamp[id] = g->stamp_now;
+
+                if (n >= max_out) return n;
+                out_ids[n++] = id;
+            }
+        }
+    }
+
+    return n;
+}
+
+void grid_set_layer(SpatialGrid* g, int id, unsigned int layer)
+{
+    if (id < 0 || id >= g->max_ids) return;
+    g->layer[id] = layer;
+}
+
+int grid_query_mask(SpatialGrid* g, float x, float y, float w, float h,
+                    unsigned int mask, int* out_ids, int max_out)
+{
+    int n = 0;
+
+    g->stamp_now++;
+
+    int cx0 = grid_cell(x, g->cell_size, g->cols);
+    int cy0 = grid_cell(y, g->cell_size, g->rows);
+    int cx1 = grid_cell(x + w, g->cell_size, g->cols);
+    int cy1 = grid_cell(y + h, g->cell_size, g->rows);
+
+    for (int cy = cy0; cy <= cy1; cy++)
+    {
+        for (int cx = cx0; cx <= cx1; cx++)
+        {
+            for (int e = g->heads[cy * g->cols + cx]; e != -1; e = g->entry_next[e])
+            {
+                int id = g->entry_id[e];
+                if (g->stamp[id] == g->stamp_now) continue;
+                g->stamp[id] = g->stamp_now;
+
+                if (!layers_match(g->layer[id], mask)) continue;
+
+                if (n >= max_out) return n;
+                out_ids[n++] = id;
+            }
+        }
+    }
+
+    return n;
+}
+
+/* ============== STATIC INDEX ============== */
+
+int static_index_init(StaticIndex* s, int cap)
+{
+    s->rects = malloc(sizeof(float) * 4 * (size_t)cap);
+    s->layer = malloc(sizeof(unsigned int) * (size_t)cap);
+    s->count = 0;
+    s->cap = cap;
+    s->max_w = 0.0f;
+    s->built = 0;
+
+    if (!s->rects || !s->layer)
+    {
+        printf("static_index_init failed: out of memory (%d rects)\n", cap);
+        static_index_destroy(s);
+        return 0;
+    }
+
+    return 1;
+}
+
+void static_index_destroy(StaticIndex* s)
+{
+    free(s->rects);
+    free(s->layer);
+    s->rects = NULL;
+    s->layer = NULL;
+    s->count = 0;
+}
+
+void static_add(StaticIndex* s, float x, float y, float w, float h,
+                unsigned int layer)
+{
+    if (s->count >= s->cap) return;
+
+    float* r = s->rects + s->count * 4;
+    r[0] = x;
+    r[1] = y;
+    r[2] = w;
+    r[3] = h;
+    s->layer[s->count] = layer;
+    s->count++;
+
+    if (w > s->max_w) s->max_w = w;
+    s->built = 0;
+}
+
+void static_build(StaticIndex* s)
+{
+    // insertion sort by x — build runs once per level, not per tick
+    for (int i = 1; i < s->count; i++)
+    {
+        float rx = s->rects[i * 4 + 0];
+        float ry = s->rects[i * 4 + 1];
+        float rw = s->rects[i * 4 + 2];
+        float rh = s->rects[i * 4 + 3];
+        unsigned int rl = s->layer[i];
+
+        int j = i - 1;
+        while (j >= 0 && s->rects[j * 4] > rx)
+        {
+            memcpy(s->rects + (j + 1) * 4, s->rects + j * 4, sizeof(float) * 4);
+            s->layer[j + 1] = s->layer[j];
+            j--;
+        }
+
+        s->rects[(j + 1) * 4 + 0] = rx;
+        s->rects[(j + 1) * 4 + 1] = ry;
+        s->rects[(j + 1) * 4 + 2] = rw;
+        s->rects[(j + 1) * 4 + 3] = rh;
+        s->layer[j + 1] = rl;
+    }
+
+    s->built = 1;
+}
+
+int static_query(const StaticIndex* s, float x, float y, float w, float h,
+                 unsigned int mask, int* out_ids, int max_out)
+{
+    int n = 0;
+
+    if (!s->built)
+    {
+        // binary search needs the sort; stay correct until then
+        printf("static_query: static_build not called, scanning linearly\n");
+
+        for (int i = 0; i < s->count; i++)
+        {
+            if (!layers_match(s->layer[i], mask)) continue;
+
+            const float* r = s->rects + i * 4;
+            if (!rect_overlaps(x, y, w, h, r[0], r[1], r[2], r[3])) continue;
+
+            if (n >= max_out) return n;
+            out_ids[n++] = i;
+        }
+
+        return n;
+    }
+
+    // binary search for the first rect that could still reach the
+    // query: its left edge is at most max_w to the left of us
+    float x_min = x - s->max_w;
+    int lo = 0, hi = s->count;
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (s->rects[mid * 4] < x_min) lo = mid + 1;
+        else hi = mid;
+    }
+
+    // walk right until rects start past our right edge
+    for (int i = lo; i < s->count && s->rects[i * 4] < x + w; i++)
+    {
+        if (!layers_match(s->layer[i], mask)) continue;
+
+        const float* r = s->rects + i * 4;
+        if (!rect_overlaps(x, y, w, h, r[0], r[1], r[2], r[3])) continue;
+
+        if (n >= max_out) return n;
+        out_ids[n++] = i;
+    }
+
+    return n;
+}
+
 void cam_follow(float* cam_x, float* cam_y,
                 float target_x, float target_y,
                 float view_w, float view_h)
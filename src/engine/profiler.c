@@ -0,0 +1,151 @@
+#include "Profiler.h"
+#include <stdio.h>
+#include <string.h>
+
+typedef struct ProfZone
+{
+    const char* name;
+    Uint64 frame_ticks;             // accumulated this frame
+    float history_ms[PROF_HISTORY]; // per-frame totals, ring
+} ProfZone;
+
+static ProfZone zones[PROF_MAX_ZONES];
+static int zone_count = 0;
+
+static int history_pos = 0;
+static int history_len = 0;     // frames recorded, caps at PROF_HISTORY
+
+static int stack[PROF_MAX_DEPTH];
+static Uint64 stack_start[PROF_MAX_DEPTH];
+static int depth = 0;
+
+static int zone_find(const char* name)
+{
+    for (int i = 0; i < zone_count; i++)
+        if (zones[i].name == name || strcmp(zones[i].name, name) == 0)
+            return i;
+
+    if (zone_count >= PROF_MAX_ZONES)
+        return -1;
+
+    zones[zone_count].name = name;
+    zones[zone_count].frame_ticks = 0;
+    memset(zones[zone_count].history_ms, 0, sizeof(zones[zone_count].history_ms));
+    return zone_count++;
+}
+
+void prof_begin(const char* name)
+{
+    if (depth >= PROF_MAX_DEPTH)
+        return;
+
+    stack[depth] = zone_find(name);
+    stack_start[depth] = SDL_GetPerformanceCounter();
+    depth++;
+}
+
+void prof_end(void)
+{
+    if (depth <= 0)
+        return;
+
+    depth--;
+
+    int z = stack[depth];
+    if (z >= 0)
+        zones[z].frame_ticks += SDL_GetPerformanceCounter() - stack_start[depth];
+}
+
+void prof_frame_end(void)
+{
+    float to_ms = 1000.0f / (float)SDL_GetPerformanceFrequency();
+
+    for (int i = 0; i < zone_count; i++)
+    {
+        zones[i].history_ms[history_pos] = (float)zones[i].frame_ticks * to_ms;
+        zones[i].frame_ticks = 0;
+    }
+
+    history_pos = (history_pos + 1) % PROF_HISTORY;
+    if (history_len < PROF_HISTORY)
+        history_len++;
+
+    depth = 0;  // recover from unbalanced begin/end rather than corrupting
+}
+
+int prof_get_stats(ProfZoneStats* out, int max_out)
+{
+    int n = zone_count < max_out ? zone_count : max_out;
+
+    for (int i = 0; i < n; i++)
+    {
+        ProfZoneStats* s = &out[i];
+        s->name = zones[i].name;
+
+        int last = (history_pos + PROF_HISTORY - 1) % PROF_HISTORY;
+        s->last_ms = zones[i].history_ms[last];
+
+        s->min_ms = 0.0f;
+        s->avg_ms = 0.0f;
+        s->max_ms = 0.0f;
+
+        if (history_len == 0)
+            continue;
+
+        float sum = 0.0f;
+        s->min_ms = zones[i].history_ms[0];
+
+        for (int f = 0; f < history_len; f++)
+        {
+            float ms = zones[i].history_ms[f];
+            sum += ms;
+            if (ms < s->min_ms) s->min_ms = ms;
+            if (ms > s->max_ms) s->max_ms = ms;
+        }
+
+        s->avg_ms = sum / (float)history_len;
+    }
+
+    return n;
+}
+
+void prof_draw_overlay(SDL_Renderer* renderer, int x, int y, float px_per_ms)
+{
+    static const Uint8 palette[][3] = {
+        { 230,  80,  80 },
+        {  80, 200,  90 },
+        {  90, 130, 230 },
+        { 230, 200,  70 },
+        { 200,  90, 210 },
+        {  80, 210, 210 },
+    };
+    const int palette_n = (int)(sizeof(palette) / sizeof(palette[0]));
+
+    const int row_h = 8;
+    const int row_pad = 2;
+
+    if (px_per_ms <= 0.0f)
+        px_per_ms = 10.0f;
+
+    ProfZoneStats stats[PROF_MAX_ZONES];
+    int n = prof_get_stats(stats, PROF_MAX_ZONES);
+
+    // dim backdrop so bars read over the scene
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_Rect back = { x - 2, y - 2, 204, n * (row_h + row_pad) + 4 };
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 160);
+    SDL_RenderFillRect(renderer, &back);
+
+    for (int i = 0; i < n; i++)
+    {
+        int w = (int)(stats[i].last_ms * px_per_ms);
+        if (w < 1) w = 1;
+        if (w > 200) w = 200;
+
+        const Uint8* c = palette[i % palette_n];
+        SDL_SetRenderDrawColor(renderer, c[0], c[1], c[2], 230);
+
+        SDL_Rect bar = { x, y + i * (row_h + row_pad), w, row_h };
+        SDL_RenderFillRect(renderer, &bar);
+    }
+}
@@ -0,0 +1,72 @@
+#include "RenderCache.h"
+#include <stdio.h>
+
+int rcache_init(RenderCache* c, SDL_Renderer* renderer,
+                float world_x, float world_y, int w, int h)
+{
+    c->target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                  SDL_TEXTUREACCESS_TARGET, w, h);
+    if (!c->target)
+    {
+        printf("rcache_init: SDL_CreateTexture failed (%dx%d): %s\n",
+               w, h, SDL_GetError());
+        c->w = c->h = 0;
+        c->dirty = 0;
+        return 0;
+    }
+
+    SDL_SetTextureBlendMode(c->target, SDL_BLENDMODE_BLEND);
+
+    c->w = w;
+    c->h = h;
+    c->world_x = world_x;
+    c->world_y = world_y;
+    c->dirty = 1;
+
+    return 1;
+}
+
+void rcache_destroy(RenderCache* c)
+{
+    if (c->target)
+    {
+        SDL_DestroyTexture(c->target);
+        c->target = NULL;
+    }
+    c->dirty = 0;
+}
+
+void rcache_invalidate(RenderCache* c)
+{
+    c->dirty = 1;
+}
+
+void rcache_draw(RenderCache* c, SDL_Renderer* renderer, Vec2 cam,
+                 RenderCacheBakeFn bake, void* user)
+{
+    if (!c->target)
+        return;
+
+    if (c->dirty && bake)
+    {
+        SDL_Texture* prev = SDL_GetRenderTarget(renderer);
+        SDL_SetRenderTarget(renderer, c->target);
+
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+
+        bake(renderer, user);
+
+        SDL_SetRenderTarget(renderer, prev);
+        c->dirty = 0;
+    }
+
+    SDL_Rect dst = {
+        (int)(c->world_x - cam.x),
+        (int)(c->world_y - cam.y),
+        c->w,
+        c->h
+    };
+    SDL_RenderCopy(renderer, c->target, NULL, &dst);
+}
@@ -0,0 +1,117 @@
+#include "RenderQueue.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+int rq_init(RenderQueue* q, int cap)
+{
+    if (cap <= 0)
+        cap = SPRITEBATCH_DEFAULT_CAPACITY;
+
+    q->buf[0] = malloc(sizeof(RenderCmd) * (size_t)cap);
+    q->buf[1] = malloc(sizeof(RenderCmd) * (size_t)cap);
+    q->order = malloc(sizeof(int) * (size_t)cap);
+    q->count[0] = 0;
+    q->count[1] = 0;
+    q->cap = cap;
+    q->record = 0;
+
+    if (!q->buf[0] || !q->buf[1] || !q->order)
+    {
+        printf("rq_init failed: out of memory (%d commands)\n", cap);
+        rq_destroy(q);
+        return 0;
+    }
+
+    return 1;
+}
+
+void rq_destroy(RenderQueue* q)
+{
+    free(q->buf[0]);
+    free(q->buf[1]);
+    free(q->order);
+    q->buf[0] = NULL;
+    q->buf[1] = NULL;
+    q->order = NULL;
+    q->count[0] = 0;
+    q->count[1] = 0;
+}
+
+void rq_push(RenderQueue* q, Texture* tex, const SDL_Rect* src,
+             float x, float y, float w, float h, int z)
+{
+    int rec = q->record;
+    if (q->count[rec] >= q->cap) return;
+
+    RenderCmd* c = &q->buf[rec][q->count[rec]++];
+    c->tex = tex;
+    if (src)
+    {
+        c->src = *src;
+        c->has_src = 1;
+    }
+    else
+    {
+        c->has_src = 0;
+    }
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    c->z = z;
+}
+
+void rq_push_tex(RenderQueue* q, Texture* tex, float x, float y, int z)
+{
+    rq_push(q, tex, NULL, x, y,
+            (float)tex->draw_w, (float)tex->draw_h, z);
+}
+
+void rq_swap(RenderQueue* q)
+{
+    q->record ^= 1;
+    q->count[q->record] = 0;    // the buffer we now record into
+}
+
+/* qsort can't take context, so the comparator reads the buffer being
+   replayed through this pointer. Replay runs on one thread. */
+static const RenderCmd* sort_cmds;
+
+static int cmd_cmp(const void* pa, const void* pb)
+{
+    const RenderCmd* a = &sort_cmds[*(const int*)pa];
+    const RenderCmd* b = &sort_cmds[*(const int*)pb];
+
+    if (a->z != b->z)
+        return a->z < b->z ? -1 : 1;
+
+    // group same-z commands by texture so batch runs stay long;
+    // atlas views share the same SDL_Texture and land together
+    if (a->tex->sdl_texture != b->tex->sdl_texture)
+        return a->tex->sdl_texture < b->tex->sdl_texture ? -1 : 1;
+
+    // keep submission order for equal keys (qsort is not stable)
+    return *(const int*)pa - *(const int*)pb;
+}
+
+void rq_replay(RenderQueue* q, SpriteBatch* b)
+{
+    int rep = q->record ^ 1;
+    int n = q->count[rep];
+    RenderCmd* cmds = q->buf[rep];
+
+    for (int i = 0; i < n; i++)
+        q->order[i] = i;
+
+    sort_cmds = cmds;
+    qsort(q->order, (size_t)n, sizeof(int), cmd_cmp);
+
+    batch_begin(b);
+    for (int i = 0; i < n; i++)
+    {
+        RenderCmd* c = &cmds[q->order[i]];
+        batch_push(b, c->tex, c->has_src ? &c->src : NULL,
+                   c->x, c->y, c->w, c->h);
+    }
+    batch_flush(b);
+}
@@ -1,4 +1,5 @@
 #include "RenderWindow.h"
+#include "Arena.h"
 #include <stdio.h>
 
 void window_init(RenderWindow* rw, const char* title, int width, int height)
@@ -7,6 +8,18 @@ void window_init(RenderWindow* rw, const char* title, int width, int height)
 	rw->width = width;
 	rw->height = height;
 
+	rw->dirty_mode = 0;
+	rw->dirty_count = 0;
+	rw->dirty_all = 0;
+	rw->persist = NULL;
+
+	rw->target_fps = 0;
+	rw->frame_deadline = 0;
+	rw->missed_deadlines = 0;
+
+	rw->headless = 0;
+	rw->backbuffer = NULL;
+
 	rw->window = SDL_CreateWindow(
 		title, 
 		SDL_WINDOWPOS_UNDEFINED, 
@@ -35,25 +48,254 @@ void window_init(RenderWindow* rw, const char* title, int width, int height)
     }
 }
 
+void window_init_headless(RenderWindow* rw, int width, int height)
+{
+	rw->title = "headless";
+	rw->width = width;
+	rw->height = height;
+
+	rw->dirty_mode = 0;
+	rw->dirty_count = 0;
+	rw->dirty_all = 0;
+	rw->persist = NULL;
+
+	rw->target_fps = 0;
+	rw->frame_deadline = 0;
+	rw->missed_deadlines = 0;
+
+	rw->headless = 1;
+	rw->window = NULL;
+
+	// 1x1 backbuffer: draws survive every code path but clip away
+	rw->backbuffer = SDL_CreateRGBSurfaceWithFormat(
+		0, 1, 1, 32, SDL_PIXELFORMAT_RGBA32);
+	if (!rw->backbuffer)
+	{
+		printf("INFO: HEADLESS SURFACE FAILED TO CREATE. ERR: %s\n", SDL_GetError());
+		rw->renderer = NULL;
+		return;
+	}
+
+	rw->renderer = SDL_CreateSoftwareRenderer(rw->backbuffer);
+	if (!rw->renderer)
+	{
+		printf("INFO: HEADLESS RENDERER FAILED TO CREATE: ERR: %s\n", SDL_GetError());
+		SDL_FreeSurface(rw->backbuffer);
+		rw->backbuffer = NULL;
+	}
+}
+
 void window_clear(RenderWindow* rw)
 {
 	SDL_SetRenderDrawColor(rw->renderer, 20, 20, 20, 255);
     SDL_RenderClear(rw->renderer);
 }
 
+/* sleep coarsely until ~2 ms before the deadline, then spin for the
+   precision SDL_Delay can't give */
+static void pace_frame(RenderWindow* rw)
+{
+    if (rw->target_fps <= 0)
+        return;
+
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    Uint64 step = freq / (Uint64)rw->target_fps;
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    if (rw->frame_deadline == 0)
+        rw->frame_deadline = now + step;
+
+    if (now > rw->frame_deadline)
+    {
+        // blew the budget: count it and resync instead of rushing
+        // the next frames to catch up
+        rw->missed_deadlines++;
+        rw->frame_deadline = now + step;
+        return;
+    }
+
+    while (rw->frame_deadline - now > freq / 500)   // > 2 ms left
+    {
+        SDL_Delay(1);
+        now = SDL_GetPerformanceCounter();
+    }
+
+    while (now < rw->frame_deadline)
+        now = SDL_GetPerformanceCounter();
+
+    rw->frame_deadline += step;
+}
+
 void window_present(RenderWindow* rw)
 {
-	SDL_RenderPresent(rw->renderer);
+	if (rw->dirty_mode && rw->persist)
+	{
+		// the target holds the complete frame; copy it whole so
+		// pixels outside the dirty rects survive the present
+		SDL_SetRenderTarget(rw->renderer, NULL);
+		SDL_RenderCopy(rw->renderer, rw->persist, NULL, NULL);
+	}
+
+	if (!rw->headless)
+		SDL_RenderPresent(rw->renderer);
+
+	pace_frame(rw);
+
+	// transient per-frame data dies here
+	scratch_frame_end();
+
+	// regions are repainted now; start the next frame clean
+	rw->dirty_count = 0;
+	rw->dirty_all = 0;
+}
+
+int window_set_vsync(RenderWindow* rw, WindowVsync mode)
+{
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (mode == WINDOW_VSYNC_ADAPTIVE)
+    {
+        // late-tearing swap is a GL-only nicety; fall back to hard
+        // vsync where the backend refuses
+        if (SDL_GL_SetSwapInterval(-1) == 0)
+            return 1;
+        mode = WINDOW_VSYNC_ON;
+    }
+
+    if (SDL_RenderSetVSync(rw->renderer, mode == WINDOW_VSYNC_ON ? 1 : 0) != 0)
+    {
+        printf("window_set_vsync: not supported by this renderer: %s\n", SDL_GetError());
+        return 0;
+    }
+
+    return 1;
+#else
+    (void)rw; (void)mode;
+    printf("window_set_vsync: needs SDL 2.0.18+ (renderer was created with hard vsync)\n");
+    return 0;
+#endif
+}
+
+void window_set_target_fps(RenderWindow* rw, int fps)
+{
+    rw->target_fps = fps;
+    rw->frame_deadline = 0;
+}
+
+int window_missed_deadlines(const RenderWindow* rw)
+{
+    return rw->missed_deadlines;
+}
+
+void window_set_dirty_mode(RenderWindow* rw, int enable)
+{
+    if (enable && !rw->persist)
+    {
+        // the window backbuffer is undefined after present on
+        // accelerated backends, so partial redraws accumulate in a
+        // persistent target texture instead
+        rw->persist = SDL_CreateTexture(rw->renderer, SDL_PIXELFORMAT_RGBA8888,
+                                        SDL_TEXTUREACCESS_TARGET,
+                                        rw->width, rw->height);
+        if (!rw->persist)
+        {
+            printf("window_set_dirty_mode: target texture failed: %s\n",
+                   SDL_GetError());
+            rw->dirty_mode = 0;
+            return;
+        }
+    }
+
+    if (!enable && rw->persist)
+    {
+        SDL_SetRenderTarget(rw->renderer, NULL);
+        SDL_DestroyTexture(rw->persist);
+        rw->persist = NULL;
+    }
+
+    rw->dirty_mode = enable;
+    rw->dirty_count = 0;
+
+    // repaint everything once so the target starts valid
+    rw->dirty_all = enable;
+}
+
+void window_mark_dirty(RenderWindow* rw, int x, int y, int w, int h)
+{
+    if (rw->dirty_all)
+        return;
+
+    if (rw->dirty_count >= RW_MAX_DIRTY)
+    {
+        // too fragmented to be worth tracking — repaint everything
+        rw->dirty_all = 1;
+        return;
+    }
+
+    rw->dirty[rw->dirty_count++] = (SDL_Rect){ x, y, w, h };
+}
+
+void window_mark_all_dirty(RenderWindow* rw)
+{
+    rw->dirty_all = 1;
+}
+
+int window_begin_frame(RenderWindow* rw)
+{
+    if (!rw->dirty_mode || !rw->persist)
+    {
+        window_clear(rw);
+        return 1;
+    }
+
+    if (!rw->dirty_all && rw->dirty_count == 0)
+    {
+        // fully clean: skip drawing and present, but keep the
+        // per-frame duties that live in window_present — otherwise
+        // idle frames spin uncapped and scratch is never reset
+        pace_frame(rw);
+        scratch_frame_end();
+        return 0;
+    }
+
+    // partial redraws go into the persistent target, not the
+    // backbuffer; window_present copies it out whole
+    SDL_SetRenderTarget(rw->renderer, rw->persist);
+
+    if (rw->dirty_all)
+    {
+        window_clear(rw);
+        return 1;
+    }
+
+    SDL_SetRenderDrawColor(rw->renderer, 20, 20, 20, 255);
+    SDL_RenderFillRects(rw->renderer, rw->dirty, rw->dirty_count);
+    return 1;
+}
+
+const SDL_Rect* window_dirty_rects(const RenderWindow* rw, int* count)
+{
+    if (count)
+        *count = rw->dirty_all ? 0 : rw->dirty_count;
+    return rw->dirty;
 }
 
 void window_destroy(RenderWindow* rw)
 {
+    // the target texture belongs to the renderer — free it first
+    if (rw->persist)
+        SDL_DestroyTexture(rw->persist);
+    rw->persist = NULL;
+
     if (rw->renderer)
         SDL_DestroyRenderer(rw->renderer);
 
     if (rw->window)
         SDL_DestroyWindow(rw->window);
 
+    if (rw->backbuffer)
+        SDL_FreeSurface(rw->backbuffer);
+
     rw->renderer = NULL;
     rw->window = NULL;
+    rw->backbuffer = NULL;
 }
\ No newline at end of file
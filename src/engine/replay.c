@@ -0,0 +1,272 @@
+#include "Replay.h"
+#include "Input.h"
+#include <stdio.h>
+#include <string.h>
+
+#define REPLAY_MAGIC "SREC"
+#define REPLAY_VERSION 1u
+
+/* kinds */
+enum
+{
+    REV_KEY_DOWN = 1,
+    REV_KEY_UP,
+    REV_MOUSE_DOWN,
+    REV_MOUSE_UP,
+    REV_MOUSE_MOVE,
+    REV_FRAME,      // render-frame boundary; tick = total ticks so far
+};
+
+/* 16 bytes, no padding — written and read as-is */
+typedef struct ReplayEvent
+{
+    Uint32 tick;
+    Uint16 kind;
+    Uint16 code;    // scancode or mouse button
+    Sint32 x;
+    Sint32 y;
+} ReplayEvent;
+
+typedef struct ReplayHeader
+{
+    char magic[4];
+    Uint32 version;
+    Uint32 tick_hz;
+    Uint32 reserved;
+} ReplayHeader;
+
+/* ---- recording ---- */
+
+static FILE* rec_file = NULL;
+static Uint32 rec_tick = 0;
+static ReplayEvent rec_motion;      // coalesced to one move per tick
+static int rec_has_motion = 0;
+
+int replay_record_begin(const char* path, int tick_hz)
+{
+    if (rec_file)
+        replay_record_end();
+
+    rec_file = fopen(path, "wb");
+    if (!rec_file)
+    {
+        printf("replay_record_begin: can't open '%s'\n", path);
+        return 0;
+    }
+
+    ReplayHeader h;
+    memcpy(h.magic, REPLAY_MAGIC, 4);
+    h.version = REPLAY_VERSION;
+    h.tick_hz = (Uint32)tick_hz;
+    h.reserved = 0;
+    fwrite(&h, sizeof(h), 1, rec_file);
+
+    rec_tick = 0;
+    rec_has_motion = 0;
+    return 1;
+}
+
+int replay_recording(void)
+{
+    return rec_file != NULL;
+}
+
+static void rec_write(Uint16 kind, Uint16 code, Sint32 x, Sint32 y)
+{
+    ReplayEvent ev = { rec_tick, kind, code, x, y };
+    fwrite(&ev, sizeof(ev), 1, rec_file);
+}
+
+static void rec_flush_motion(void)
+{
+    if (!rec_has_motion)
+        return;
+    fwrite(&rec_motion, sizeof(rec_motion), 1, rec_file);
+    rec_has_motion = 0;
+}
+
+void replay_record_event(const SDL_Event* e)
+{
+    if (!rec_file)
+        return;
+
+    switch (e->type)
+    {
+        case SDL_KEYDOWN:
+            if (e->key.repeat) break;
+            rec_flush_motion();
+            rec_write(REV_KEY_DOWN, (Uint16)e->key.keysym.scancode, 0, 0);
+            break;
+
+        case SDL_KEYUP:
+            rec_flush_motion();
+            rec_write(REV_KEY_UP, (Uint16)e->key.keysym.scancode, 0, 0);
+            break;
+
+        case SDL_MOUSEBUTTONDOWN:
+            rec_flush_motion();
+            rec_write(REV_MOUSE_DOWN, e->button.button, e->button.x, e->button.y);
+            break;
+
+        case SDL_MOUSEBUTTONUP:
+            rec_flush_motion();
+            rec_write(REV_MOUSE_UP, e->button.button, e->button.x, e->button.y);
+            break;
+
+        case SDL_MOUSEMOTION:
+            // keep only the last position this tick
+            rec_motion = (ReplayEvent){ rec_tick, REV_MOUSE_MOVE, 0,
+                                        e->motion.x, e->motion.y };
+            rec_has_motion = 1;
+            break;
+
+        default:
+            break;
+    }
+}
+
+void replay_record_tick(void)
+{
+    if (!rec_file)
+        return;
+    rec_flush_motion();
+    rec_tick++;
+}
+
+void replay_record_frame(void)
+{
+    if (!rec_file)
+        return;
+    rec_flush_motion();
+    rec_write(REV_FRAME, 0, 0, 0);
+}
+
+void replay_record_end(void)
+{
+    if (!rec_file)
+        return;
+    rec_flush_motion();
+    fclose(rec_file);
+    rec_file = NULL;
+}
+
+/* ---- playback ---- */
+
+static ReplayEvent* play_events = NULL;
+static void* play_blob = NULL;      // SDL_LoadFile allocation
+static int play_count = 0;
+static int play_cursor = 0;
+static Uint32 play_tick = 0;
+static int play_active = 0;
+
+int replay_play_begin(const char* path)
+{
+    if (play_active)
+        replay_play_end();
+
+    size_t size = 0;
+    play_blob = SDL_LoadFile(path, &size);
+    if (!play_blob || size < sizeof(ReplayHeader))
+    {
+        printf("replay_play_begin: can't read '%s'\n", path);
+        SDL_free(play_blob);
+        play_blob = NULL;
+        return 0;
+    }
+
+    ReplayHeader* h = play_blob;
+    if (memcmp(h->magic, REPLAY_MAGIC, 4) != 0 || h->version != REPLAY_VERSION)
+    {
+        printf("replay_play_begin: '%s' is not a v%u replay log\n",
+               path, REPLAY_VERSION);
+        SDL_free(play_blob);
+        play_blob = NULL;
+        return 0;
+    }
+
+    play_events = (ReplayEvent*)((char*)play_blob + sizeof(ReplayHeader));
+    play_count = (int)((size - sizeof(ReplayHeader)) / sizeof(ReplayEvent));
+    play_cursor = 0;
+    play_tick = 0;
+    play_active = 1;
+
+    return (int)h->tick_hz;
+}
+
+int replay_playing(void)
+{
+    return play_active;
+}
+
+/* synthesize the recorded event and push it through the Input layer */
+static void play_feed(const ReplayEvent* ev)
+{
+    SDL_Event e;
+    memset(&e, 0, sizeof(e));
+
+    switch (ev->kind)
+    {
+        case REV_KEY_DOWN:
+        case REV_KEY_UP:
+            e.type = ev->kind == REV_KEY_DOWN ? SDL_KEYDOWN : SDL_KEYUP;
+            e.key.keysym.scancode = (SDL_Scancode)ev->code;
+            break;
+
+        case REV_MOUSE_DOWN:
+        case REV_MOUSE_UP:
+            e.type = ev->kind == REV_MOUSE_DOWN ? SDL_MOUSEBUTTONDOWN
+                                                : SDL_MOUSEBUTTONUP;
+            e.button.button = (Uint8)ev->code;
+            e.button.x = ev->x;
+            e.button.y = ev->y;
+            break;
+
+        case REV_MOUSE_MOVE:
+            e.type = SDL_MOUSEMOTION;
+            e.motion.x = ev->x;
+            e.motion.y = ev->y;
+            break;
+
+        default:
+            return;
+    }
+
+    input_process_event(&e);
+}
+
+int replay_play_frame(void)
+{
+    if (!play_active)
+        return 0;
+
+    while (play_cursor < play_count)
+    {
+        const ReplayEvent* ev = &play_events[play_cursor++];
+
+        if (ev->kind == REV_FRAME)
+        {
+            // ticks this frame ran, from the boundary tick counts
+            int ticks = (int)(ev->tick - play_tick);
+            play_tick = ev->tick;
+
+            if (play_cursor >= play_count)
+                play_active = 0;    // log drained: run is over
+            return ticks;
+        }
+
+        play_feed(ev);
+    }
+
+    // no closing boundary: the recording was cut off mid-frame
+    play_active = 0;
+    return 0;
+}
+
+void replay_play_end(void)
+{
+    SDL_free(play_blob);
+    play_blob = NULL;
+    play_events = NULL;
+    play_count = 0;
+    play_active = 0;
+}
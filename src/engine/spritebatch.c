@@ -0,0 +1,119 @@
+#include "SpriteBatch.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+int batch_init(SpriteBatch* b, SDL_Renderer* renderer, int capacity)
+{
+    if (capacity <= 0)
+        capacity = SPRITEBATCH_DEFAULT_CAPACITY;
+
+    b->renderer = renderer;
+    b->count = 0;
+    b->capacity = capacity;
+    b->current = NULL;
+
+    b->verts = malloc(sizeof(SDL_Vertex) * 4 * (size_t)capacity);
+    b->indices = malloc(sizeof(int) * 6 * (size_t)capacity);
+
+    if (!b->verts || !b->indices)
+    {
+        printf("batch_init failed: out of memory for %d sprites\n", capacity);
+        free(b->verts);
+        free(b->indices);
+        b->verts = NULL;
+        b->indices = NULL;
+        b->capacity = 0;
+        return 0;
+    }
+
+    // the index pattern never changes: two triangles per quad
+    for (int i = 0; i < capacity; i++)
+    {
+        int v = i * 4;
+        int* idx = b->indices + i * 6;
+        idx[0] = v + 0; idx[1] = v + 1; idx[2] = v + 2;
+        idx[3] = v + 2; idx[4] = v + 1; idx[5] = v + 3;
+    }
+
+    return 1;
+}
+
+void batch_destroy(SpriteBatch* b)
+{
+    free(b->verts);
+    free(b->indices);
+    b->verts = NULL;
+    b->indices = NULL;
+    b->count = 0;
+    b->capacity = 0;
+    b->current = NULL;
+}
+
+void batch_begin(SpriteBatch* b)
+{
+    b->count = 0;
+    b->current = NULL;
+}
+
+void batch_push(SpriteBatch* b, Texture* tex, const SDL_Rect* src,
+                float x, float y, float w, float h)
+{
+    if (!tex || !tex->sdl_texture || !b->verts) return;
+
+    // texture change or full buffer ends the current run
+    if (b->count > 0 && (b->current != tex->sdl_texture || b->count >= b->capacity))
+        batch_flush(b);
+
+    b->current = tex->sdl_texture;
+
+    // UVs are normalized against the full sheet, not the atlas region
+    int sheet_w = tex->sheet_w > 0 ? tex->sheet_w : tex->width;
+    int sheet_h = tex->sheet_h > 0 ? tex->sheet_h : tex->height;
+
+    float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    if (src && sheet_w > 0 && sheet_h > 0)
+    {
+        u0 = (float)src->x / (float)sheet_w;
+        v0 = (float)src->y / (float)sheet_h;
+        u1 = (float)(src->x + src->w) / (float)sheet_w;
+        v1 = (float)(src->y + src->h) / (float)sheet_h;
+    }
+
+    SDL_Vertex* q = b->verts + b->count * 4;
+    SDL_Color white = { 255, 255, 255, 255 };
+
+    q[0].position.x = x;     q[0].position.y = y;     q[0].tex_coord.x = u0; q[0].tex_coord.y = v0;
+    q[1].position.x = x + w; q[1].position.y = y;     q[1].tex_coord.x = u1; q[1].tex_coord.y = v0;
+    q[2].position.x = x;     q[2].position.y = y + h; q[2].tex_coord.x = u0; q[2].tex_coord.y = v1;
+    q[3].position.x = x + w; q[3].position.y = y + h; q[3].tex_coord.x = u1; q[3].tex_coord.y = v1;
+
+    q[0].color = white;
+    q[1].color = white;
+    q[2].color = white;
+    q[3].color = white;
+
+    b->count++;
+}
+
+void batch_push_tex(SpriteBatch* b, Texture* tex, float x, float y)
+{
+    if (!tex) return;
+    batch_push(b, tex, tex->has_src ? &tex->src : NULL,
+               x, y, (float)tex->draw_w, (float)tex->draw_h);
+}
+
+void batch_flush(SpriteBatch* b)
+{
+    if (b->count <= 0)
+    {
+        b->current = NULL;
+        return;
+    }
+
+    SDL_RenderGeometry(b->renderer, b->current,
+                       b->verts, b->count * 4,
+                       b->indices, b->count * 6);
+
+    b->count = 0;
+    b->current = NULL;
+}
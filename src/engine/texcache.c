@@ -0,0 +1,109 @@
+#include "TexCache.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEXCACHE_PATH_MAX 256
+
+typedef struct TexCacheEntry
+{
+    char path[TEXCACHE_PATH_MAX];
+    int vw, vh;         // variant size; 0,0 = native resolution
+    Texture tex;
+    int refs;
+    int used;
+} TexCacheEntry;
+
+static TexCacheEntry cache[TEXCACHE_MAX];
+static int resident = 0;
+
+Texture* tex_acquire_scaled(SDL_Renderer* renderer, const char* path,
+                            int w, int h)
+{
+    int free_slot = -1;
+
+    for (int i = 0; i < TEXCACHE_MAX; i++)
+    {
+        if (!cache[i].used)
+        {
+            if (free_slot < 0) free_slot = i;
+            continue;
+        }
+
+        if (cache[i].vw == w && cache[i].vh == h &&
+            strcmp(cache[i].path, path) == 0)
+        {
+            cache[i].refs++;
+            return &cache[i].tex;
+        }
+    }
+
+    if (free_slot < 0)
+    {
+        printf("tex_acquire: cache full (%d textures), can't load '%s'\n",
+               TEXCACHE_MAX, path);
+        return NULL;
+    }
+
+    TexCacheEntry* e = &cache[free_slot];
+
+    int ok = (w > 0 && h > 0)
+        ? load_tex_scaled(&e->tex, renderer, path, w, h)
+        : load_tex(&e->tex, renderer, path);
+    if (!ok)
+        return NULL;
+
+    strncpy(e->path, path, TEXCACHE_PATH_MAX - 1);
+    e->path[TEXCACHE_PATH_MAX - 1] = '\0';
+    e->vw = w;
+    e->vh = h;
+    e->refs = 1;
+    e->used = 1;
+    resident++;
+
+    return &e->tex;
+}
+
+Texture* tex_acquire(SDL_Renderer* renderer, const char* path)
+{
+    return tex_acquire_scaled(renderer, path, 0, 0);
+}
+
+void tex_release(Texture* tex)
+{
+    if (!tex) return;
+
+    for (int i = 0; i < TEXCACHE_MAX; i++)
+    {
+        if (!cache[i].used || &cache[i].tex != tex)
+            continue;
+
+        if (--cache[i].refs <= 0)
+        {
+            destroy_tex(&cache[i].tex);
+            cache[i].used = 0;
+            resident--;
+        }
+        return;
+    }
+
+    // not ours — caller probably mixed cached and hand-loaded textures
+    printf("tex_release: texture not owned by the cache\n");
+}
+
+int texcache_count(void)
+{
+    return resident;
+}
+
+void texcache_shutdown(void)
+{
+    for (int i = 0; i < TEXCACHE_MAX; i++)
+    {
+        if (cache[i].used)
+        {
+            destroy_tex(&cache[i].tex);
+            cache[i].used = 0;
+        }
+    }
+    resident = 0;
+}
@@ -0,0 +1,196 @@
+#include "TexLoader.h"
+#include <SDL_image.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEXLOADER_MAX_PENDING 64
+#define TEXLOADER_PATH_MAX 256
+
+typedef struct TexLoadJob
+{
+    char path[TEXLOADER_PATH_MAX];
+    TexLoadCallback cb;
+    void* user;
+    SDL_Surface* surface;   // decode result, NULL on failure
+} TexLoadJob;
+
+/* two rings: requests (main -> worker) and completions (worker -> main);
+   in_flight caps the total so neither ring can overflow */
+static TexLoadJob req_ring[TEXLOADER_MAX_PENDING];
+static int req_head = 0, req_tail = 0;
+
+static TexLoadJob done_ring[TEXLOADER_MAX_PENDING];
+static int done_head = 0, done_tail = 0;
+
+static int in_flight = 0;
+
+static SDL_mutex* lock = NULL;
+static SDL_sem* req_sem = NULL;
+static SDL_Thread* worker = NULL;
+static int running = 0;
+
+static int texloader_thread(void* data)
+{
+    (void)data;
+
+    for (;;)
+    {
+        SDL_SemWait(req_sem);
+        if (!running)
+            break;
+
+        SDL_LockMutex(lock);
+        TexLoadJob job = req_ring[req_tail];
+        req_tail = (req_tail + 1) % TEXLOADER_MAX_PENDING;
+        SDL_UnlockMutex(lock);
+
+        // the slow part: file I/O + decode, off the main thread
+        job.surface = IMG_Load(job.path);
+        if (!job.surface)
+            printf("load_tex_async: IMG_Load failed for '%s': %s\n",
+                   job.path, IMG_GetError());
+
+        SDL_LockMutex(lock);
+        done_ring[done_head] = job;
+        done_head = (done_head + 1) % TEXLOADER_MAX_PENDING;
+        SDL_UnlockMutex(lock);
+    }
+
+    return 0;
+}
+
+int texloader_init(void)
+{
+    if (running)
+        return 1;
+
+    lock = SDL_CreateMutex();
+    req_sem = SDL_CreateSemaphore(0);
+
+    if (!lock || !req_sem)
+    {
+        printf("texloader_init failed: %s\n", SDL_GetError());
+        texloader_shutdown();
+        return 0;
+    }
+
+    req_head = req_tail = 0;
+    done_head = done_tail = 0;
+    in_flight = 0;
+    running = 1;
+
+    worker = SDL_CreateThread(texloader_thread, "texloader", NULL);
+    if (!worker)
+    {
+        printf("texloader_init: SDL_CreateThread failed: %s\n", SDL_GetError());
+        running = 0;
+        texloader_shutdown();
+        return 0;
+    }
+
+    return 1;
+}
+
+void texloader_shutdown(void)
+{
+    if (worker)
+    {
+        running = 0;
+        SDL_SemPost(req_sem);   // wake the worker so it can exit
+        SDL_WaitThread(worker, NULL);
+        worker = NULL;
+    }
+
+    // free any decoded surfaces that never got uploaded
+    while (done_tail != done_head)
+    {
+        if (done_ring[done_tail].surface)
+            SDL_FreeSurface(done_ring[done_tail].surface);
+        done_tail = (done_tail + 1) % TEXLOADER_MAX_PENDING;
+    }
+
+    if (req_sem) { SDL_DestroySemaphore(req_sem); req_sem = NULL; }
+    if (lock)    { SDL_DestroyMutex(lock); lock = NULL; }
+
+    running = 0;
+    in_flight = 0;
+}
+
+int load_tex_async(const char* path, TexLoadCallback cb, void* user)
+{
+    if (!running)
+        return 0;
+
+    SDL_LockMutex(lock);
+
+    if (in_flight >= TEXLOADER_MAX_PENDING)
+    {
+        SDL_UnlockMutex(lock);
+        return 0;
+    }
+
+    TexLoadJob* job = &req_ring[req_head];
+    req_head = (req_head + 1) % TEXLOADER_MAX_PENDING;
+
+    strncpy(job->path, path, TEXLOADER_PATH_MAX - 1);
+    job->path[TEXLOADER_PATH_MAX - 1] = '\0';
+    job->cb = cb;
+    job->user = user;
+    job->surface = NULL;
+
+    in_flight++;
+
+    SDL_UnlockMutex(lock);
+    SDL_SemPost(req_sem);
+    return 1;
+}
+
+void texloader_pump(SDL_Renderer* renderer)
+{
+    if (!running)
+        return;
+
+    for (;;)
+    {
+        SDL_LockMutex(lock);
+
+        if (done_tail == done_head)
+        {
+            SDL_UnlockMutex(lock);
+            return;
+        }
+
+        TexLoadJob job = done_ring[done_tail];
+        done_tail = (done_tail + 1) % TEXLOADER_MAX_PENDING;
+        in_flight--;
+
+        SDL_UnlockMutex(lock);
+
+        // GPU upload stays on the render thread, same as load_tex
+        Texture tex = (Texture){0};
+
+        if (job.surface)
+        {
+            tex.sdl_texture = SDL_CreateTextureFromSurface(renderer, job.surface);
+            if (!tex.sdl_texture)
+            {
+                printf("load_tex_async: SDL_CreateTextureFromSurface failed: %s\n",
+                       SDL_GetError());
+            }
+            else
+            {
+                tex.width  = job.surface->w;
+                tex.height = job.surface->h;
+                tex.sheet_w = tex.width;
+                tex.sheet_h = tex.height;
+                tex.draw_w = tex.width;
+                tex.draw_h = tex.height;
+            }
+
+            SDL_FreeSurface(job.surface);
+        }
+
+        if (job.cb)
+            job.cb(&tex, job.path, job.user);
+    }
+}
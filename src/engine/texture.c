@@ -7,6 +7,9 @@ int load_tex(Texture* tex, SDL_Renderer* renderer, const char* path)
     tex->sdl_texture = NULL;
     tex->width = tex->height = 0;
     tex->draw_w = tex->draw_h = 0;
+    tex->src = (SDL_Rect){0, 0, 0, 0};
+    tex->has_src = 0;
+    tex->sheet_w = tex->sheet_h = 0;
 
     SDL_Surface* surface = IMG_Load(path);
     if (!surface)
@@ -25,6 +28,8 @@ int load_tex(Texture* tex, SDL_Renderer* renderer, const char* path)
 
     tex->width  = surface->w;
     tex->height = surface->h;
+    tex->sheet_w = tex->width;
+    tex->sheet_h = tex->height;
 
     // default draw size = original size
     tex->draw_w = tex->width;
@@ -34,6 +39,109 @@ int load_tex(Texture* tex, SDL_Renderer* renderer, const char* path)
     return 1;
 }
 
+/* Average 2x2 blocks into a half-size RGBA32 surface. */
+static SDL_Surface* halve_surface(SDL_Surface* src)
+{
+    int w = src->w / 2;
+    int h = src->h / 2;
+
+    SDL_Surface* dst = SDL_CreateRGBSurfaceWithFormat(
+        0, w, h, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!dst)
+        return NULL;
+
+    const Uint8* sp = src->pixels;
+    Uint8* dp = dst->pixels;
+
+    for (int y = 0; y < h; y++)
+    {
+        const Uint8* r0 = sp + (size_t)(y * 2) * src->pitch;
+        const Uint8* r1 = r0 + src->pitch;
+        Uint8* out = dp + (size_t)y * dst->pitch;
+
+        for (int x = 0; x < w; x++)
+        {
+            const Uint8* a = r0 + (size_t)(x * 2) * 4;
+            const Uint8* b = a + 4;
+            const Uint8* c = r1 + (size_t)(x * 2) * 4;
+            const Uint8* d = c + 4;
+
+            for (int k = 0; k < 4; k++)
+                out[x * 4 + k] = (Uint8)((a[k] + b[k] + c[k] + d[k] + 2) / 4);
+        }
+    }
+
+    return dst;
+}
+
+int load_tex_scaled(Texture* tex, SDL_Renderer* renderer, const char* path,
+                    int w, int h)
+{
+    tex->sdl_texture = NULL;
+    tex->width = tex->height = 0;
+    tex->draw_w = tex->draw_h = 0;
+    tex->src = (SDL_Rect){0, 0, 0, 0};
+    tex->has_src = 0;
+    tex->sheet_w = tex->sheet_h = 0;
+
+    SDL_Surface* loaded = IMG_Load(path);
+    if (!loaded)
+    {
+        printf("IMG_Load failed for '%s': %s\n", path, IMG_GetError());
+        return 0;
+    }
+
+    SDL_Surface* cur = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!cur)
+    {
+        printf("SDL_ConvertSurfaceFormat failed: %s\n", SDL_GetError());
+        return 0;
+    }
+
+    // box-filter down by halves while we're still >= 2x the target,
+    // so the final blit never skips pixels (no shimmer, no aliasing)
+    while (cur->w >= w * 2 && cur->h >= h * 2)
+    {
+        SDL_Surface* half = halve_surface(cur);
+        if (!half)
+            break;
+        SDL_FreeSurface(cur);
+        cur = half;
+    }
+
+    if (cur->w != w || cur->h != h)
+    {
+        SDL_Surface* exact = SDL_CreateRGBSurfaceWithFormat(
+            0, w, h, 32, SDL_PIXELFORMAT_RGBA32);
+        if (exact)
+        {
+            SDL_SetSurfaceBlendMode(cur, SDL_BLENDMODE_NONE);
+            SDL_BlitScaled(cur, NULL, exact, NULL);
+            SDL_FreeSurface(cur);
+            cur = exact;
+        }
+    }
+
+    tex->sdl_texture = SDL_CreateTextureFromSurface(renderer, cur);
+    SDL_FreeSurface(cur);
+
+    if (!tex->sdl_texture)
+    {
+        printf("SDL_CreateTextureFromSurface failed: %s\n", SDL_GetError());
+        return 0;
+    }
+
+    tex->width  = w;
+    tex->height = h;
+    tex->sheet_w = w;
+    tex->sheet_h = h;
+    tex->draw_w = w;
+    tex->draw_h = h;
+
+    return 1;
+}
+
 void scale_tex(Texture* tex, int w, int h)
 {
     tex->draw_w = w;
@@ -49,7 +157,7 @@ void scale_tex_f(Texture* tex, float sx, float sy)
 void draw_tex(Texture* tex, SDL_Renderer* renderer, int x, int y)
 {
     SDL_Rect dst = { x, y, tex->draw_w, tex->draw_h };
-    SDL_RenderCopy(renderer, tex->sdl_texture, NULL, &dst);
+    SDL_RenderCopy(renderer, tex->sdl_texture, tex->has_src ? &tex->src : NULL, &dst);
 }
 
 void destroy_tex(Texture* tex)
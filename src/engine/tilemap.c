@@ -0,0 +1,258 @@
+#include "Tilemap.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* floor(v / size) that stays correct for negative coordinates,
+   without pulling in libm */
+static int tile_floor(float v, float size)
+{
+    int i = (int)(v / size);
+    if (v < 0.0f && (float)i * size != v)
+        i--;
+    return i;
+}
+
+int tilemap_init(Tilemap* m, int width, int height, float tile_w, float tile_h)
+{
+    m->width = width;
+    m->height = height;
+    m->tile_w = tile_w;
+    m->tile_h = tile_h;
+
+    m->chunks_x = (width  + TILEMAP_CHUNK - 1) / TILEMAP_CHUNK;
+    m->chunks_y = (height + TILEMAP_CHUNK - 1) / TILEMAP_CHUNK;
+
+    m->chunks = calloc((size_t)m->chunks_x * m->chunks_y, sizeof(TileChunk));
+    memset(m->tileset, 0, sizeof(m->tileset));
+
+    if (!m->chunks)
+    {
+        printf("tilemap_init failed: out of memory for %dx%d tiles\n", width, height);
+        m->chunks_x = m->chunks_y = 0;
+        return 0;
+    }
+
+    return 1;
+}
+
+void tilemap_destroy(Tilemap* m)
+{
+    free(m->chunks);
+    m->chunks = NULL;
+    m->width = m->height = 0;
+    m->chunks_x = m->chunks_y = 0;
+}
+
+void tilemap_set_tileset(Tilemap* m, int id, Texture* tex)
+{
+    if (id <= 0 || id >= TILEMAP_MAX_TILE_KINDS) return;
+    m->tileset[id] = tex;
+}
+
+void tilemap_set(Tilemap* m, int tx, int ty, int id)
+{
+    if (tx < 0 || ty < 0 || tx >= m->width || ty >= m->height) return;
+
+    TileChunk* c = &m->chunks[(ty / TILEMAP_CHUNK) * m->chunks_x + (tx / TILEMAP_CHUNK)];
+    Uint8* slot = &c->tiles[(ty % TILEMAP_CHUNK) * TILEMAP_CHUNK + (tx % TILEMAP_CHUNK)];
+
+    if (*slot == 0 && id != 0) c->used++;
+    if (*slot != 0 && id == 0) c->used--;
+
+    *slot = (Uint8)id;
+}
+
+int tilemap_get(const Tilemap* m, int tx, int ty)
+{
+    if (tx < 0 || ty < 0 || tx >= m->width || ty >= m->height) return 0;
+
+    const TileChunk* c = &m->chunks[(ty / TILEMAP_CHUNK) * m->chunks_x + (tx / TILEMAP_CHUNK)];
+    return c->tiles[(ty % TILEMAP_CHUNK) * TILEMAP_CHUNK + (tx % TILEMAP_CHUNK)];
+}
+
+void tilemap_fill_row(Tilemap* m, int ty, int tx0, int tx1, int id)
+{
+    for (int tx = tx0; tx < tx1; tx++)
+        tilemap_set(m, tx, ty, id);
+}
+
+void tilemap_draw(Tilemap* m, SpriteBatch* batch, Vec2 cam,
+                  float view_w, float view_h)
+{
+    // visible tile range
+    int tx0 = tile_floor(cam.x, m->tile_w);
+    int ty0 = tile_floor(cam.y, m->tile_h);
+    int tx1 = tile_floor(cam.x + view_w, m->tile_w);
+    int ty1 = tile_floor(cam.y + view_h, m->tile_h);
+
+    if (tx0 < 0) tx0 = 0;
+    if (ty0 < 0) ty0 = 0;
+    if (tx1 >= m->width)  tx1 = m->width - 1;
+    if (ty1 >= m->height) ty1 = m->height - 1;
+
+    // walk chunk by chunk so empty chunks cost one branch
+    for (int cy = ty0 / TILEMAP_CHUNK; cy <= ty1 / TILEMAP_CHUNK; cy++)
+    {
+        for (int cx = tx0 / TILEMAP_CHUNK; cx <= tx1 / TILEMAP_CHUNK; cx++)
+        {
+            TileChunk* c = &m->chunks[cy * m->chunks_x + cx];
+            if (c->used == 0) continue;
+
+            int lx0 = cx * TILEMAP_CHUNK;     if (lx0 < tx0) lx0 = tx0;
+            int ly0 = cy * TILEMAP_CHUNK;     if (ly0 < ty0) ly0 = ty0;
+            int lx1 = cx * TILEMAP_CHUNK + TILEMAP_CHUNK - 1; if (lx1 > tx1) lx1 = tx1;
+            int ly1 = cy * TILEMAP_CHUNK + TILEMAP_CHUNK - 1; if (ly1 > ty1) ly1 = ty1;
+
+            for (int ty = ly0; ty <= ly1; ty++)
+            {
+                const Uint8* row = &c->tiles[(ty % TILEMAP_CHUNK) * TILEMAP_CHUNK];
+                for (int tx = lx0; tx <= lx1; tx++)
+                {
+                    Uint8 id = row[tx % TILEMAP_CHUNK];
+                    if (id == 0) continue;
+
+                    Texture* tex = m->tileset[id];
+                    if (!tex) continue;
+
+                    batch_push(batch, tex, tex->has_src ? &tex->src : NULL,
+                               tx * m->tile_w - cam.x,
+                               ty * m->tile_h - cam.y,
+                               m->tile_w, m->tile_h);
+                }
+            }
+        }
+    }
+}
+
+void tilemap_render_region(Tilemap* m, SDL_Renderer* renderer,
+                           int tx0, int ty0, int tx1, int ty1)
+{
+    if (tx0 < 0) tx0 = 0;
+    if (ty0 < 0) ty0 = 0;
+    if (tx1 >= m->width)  tx1 = m->width - 1;
+    if (ty1 >= m->height) ty1 = m->height - 1;
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        for (int tx = tx0; tx <= tx1; tx++)
+        {
+            int id = tilemap_get(m, tx, ty);
+            if (id == 0) continue;
+
+            Texture* tex = m->tileset[id];
+            if (!tex) continue;
+
+            draw_tex(tex, renderer,
+                     (int)((tx - tx0) * m->tile_w),
+                     (int)((ty - ty0) * m->tile_h));
+        }
+    }
+}
+
+static int span_solid(Tilemap* m, int tx, int ty0, int ty1)
+{
+    for (int ty = ty0; ty <= ty1; ty++)
+        if (tilemap_get(m, tx, ty)) return 1;
+    return 0;
+}
+
+static int span_solid_x(Tilemap* m, int ty, int tx0, int tx1)
+{
+    for (int tx = tx0; tx <= tx1; tx++)
+        if (tilemap_get(m, tx, ty)) return 1;
+    return 0;
+}
+
+int tilemap_collide(Tilemap* m, float* x, float* y, float w, float h,
+                    float* vx, float* vy, float dt)
+{
+    int grounded = 0;
+
+    // shave a hair off the far edges so a rect resting exactly on a
+    // tile boundary doesn't count as overlapping the next tile
+    const float eps = 0.001f;
+
+    // ---- X axis ----
+    float nx = *x + *vx * dt;
+
+    if (*vx > 0.0f)
+    {
+        int ty0 = tile_floor(*y + eps, m->tile_h);
+        int ty1 = tile_floor(*y + h - eps, m->tile_h);
+        int lead0 = tile_floor(*x + w, m->tile_w);
+        int lead1 = tile_floor(nx + w - eps, m->tile_w);
+
+        for (int tx = lead0; tx <= lead1; tx++)
+        {
+            if (span_solid(m, tx, ty0, ty1))
+            {
+                nx = tx * m->tile_w - w;
+                *vx = 0.0f;
+                break;
+            }
+        }
+    }
+    else if (*vx < 0.0f)
+    {
+        int ty0 = tile_floor(*y + eps, m->tile_h);
+        int ty1 = tile_floor(*y + h - eps, m->tile_h);
+        int lead0 = tile_floor(*x - eps, m->tile_w);
+        int lead1 = tile_floor(nx + eps, m->tile_w);
+
+        for (int tx = lead0; tx >= lead1; tx--)
+        {
+            if (span_solid(m, tx, ty0, ty1))
+            {
+                nx = (tx + 1) * m->tile_w;
+                *vx = 0.0f;
+                break;
+            }
+        }
+    }
+
+    *x = nx;
+
+    // ---- Y axis ----
+    float ny = *y + *vy * dt;
+
+    if (*vy > 0.0f)
+    {
+        int tx0 = tile_floor(*x + eps, m->tile_w);
+        int tx1 = tile_floor(*x + w - eps, m->tile_w);
+        int lead0 = tile_floor(*y + h, m->tile_h);
+        int lead1 = tile_floor(ny + h - eps, m->tile_h);
+
+        for (int ty = lead0; ty <= lead1; ty++)
+        {
+            if (span_solid_x(m, ty, tx0, tx1))
+            {
+                ny = ty * m->tile_h - h;
+                *vy = 0.0f;
+                grounded = 1;
+                break;
+            }
+        }
+    }
+    else if (*vy < 0.0f)
+    {
+        int tx0 = tile_floor(*x + eps, m->tile_w);
+        int tx1 = tile_floor(*x + w - eps, m->tile_w);
+        int lead0 = tile_floor(*y - eps, m->tile_h);
+        int lead1 = tile_floor(ny + eps, m->tile_h);
+
+        for (int ty = lead0; ty >= lead1; ty--)
+        {
+            if (span_solid_x(m, ty, tx0, tx1))
+            {
+                ny = (ty + 1) * m->tile_h;
+                *vy = 0.0f;
+                break;
+            }
+        }
+    }
+
+    *y = ny;
+
+    return grounded;
+}
@@ -0,0 +1,49 @@
+#include "Time.h"
+
+Uint64 time_now_ns(void)
+{
+    Uint64 c = SDL_GetPerformanceCounter();
+    Uint64 freq = SDL_GetPerformanceFrequency();
+
+    // split so counter * 1e9 can't overflow 64 bits
+    return (c / freq) * 1000000000ull +
+           ((c % freq) * 1000000000ull) / freq;
+}
+
+float time_dt_hr(Uint64* last_counter)
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+    float dt = (float)(now - *last_counter) / (float)SDL_GetPerformanceFrequency();
+    *last_counter = now;
+    return dt;
+}
+
+void tick_accum_init(TickAccum* ta, int tick_hz)
+{
+    if (tick_hz <= 0)
+        tick_hz = 60;
+
+    ta->last = SDL_GetPerformanceCounter();
+    ta->acc = 0;
+    ta->step = SDL_GetPerformanceFrequency() / (Uint64)tick_hz;
+}
+
+int tick_accum_advance(TickAccum* ta, int max_ticks)
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+    ta->acc += now - ta->last;
+    ta->last = now;
+
+    int ticks = (int)(ta->acc / ta->step);
+    ta->acc -= (Uint64)ticks * ta->step;
+
+    if (max_ticks > 0 && ticks > max_ticks)
+        ticks = max_ticks;  // drop the excess: a stall shouldn't snowball
+
+    return ticks;
+}
+
+float tick_accum_alpha(const TickAccum* ta)
+{
+    return (float)ta->acc / (float)ta->step;
+}
@@ -0,0 +1,127 @@
+#include "Viewport.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define VIEW_DEFAULT_CAP 2048
+
+int viewset_init(ViewSet* vs, SDL_Renderer* renderer, SpriteBatch* batch)
+{
+    memset(vs, 0, sizeof(*vs));
+    vs->renderer = renderer;
+    vs->batch = batch;
+    return 1;
+}
+
+void viewset_destroy(ViewSet* vs)
+{
+    for (int i = 0; i < vs->count; i++)
+        free(vs->views[i].cmds);
+    vs->count = 0;
+}
+
+int view_add(ViewSet* vs, SDL_Rect rect, int cap)
+{
+    if (vs->count >= VIEWPORTS_MAX)
+    {
+        printf("view_add: out of views\n");
+        return -1;
+    }
+
+    if (cap <= 0)
+        cap = VIEW_DEFAULT_CAP;
+
+    Viewport* v = &vs->views[vs->count];
+    v->cmds = malloc(sizeof(RenderCmd) * (size_t)cap);
+    if (!v->cmds)
+    {
+        printf("view_add failed: out of memory (%d commands)\n", cap);
+        return -1;
+    }
+
+    v->rect = rect;
+    v->count = 0;
+    v->cap = cap;
+
+    camera_init(&v->cam, (float)rect.w, (float)rect.h);
+
+    return vs->count++;
+}
+
+void viewset_begin(ViewSet* vs)
+{
+    for (int i = 0; i < vs->count; i++)
+        vs->views[i].count = 0;
+}
+
+unsigned int viewset_cull(const ViewSet* vs, float x, float y,
+                          float w, float h)
+{
+    unsigned int mask = 0;
+
+    for (int i = 0; i < vs->count; i++)
+        if (cam_cull_rect(&vs->views[i].cam, x, y, w, h))
+            mask |= 1u << i;
+
+    return mask;
+}
+
+void viewset_push(ViewSet* vs, unsigned int mask, Texture* tex,
+                  const SDL_Rect* src, float x, float y, float w, float h)
+{
+    for (int i = 0; i < vs->count; i++)
+    {
+        if (!(mask & (1u << i)))
+            continue;
+
+        Viewport* v = &vs->views[i];
+        if (v->count >= v->cap)
+            continue;
+
+        RenderCmd* c = &v->cmds[v->count++];
+        c->tex = tex;
+        if (src)
+        {
+            c->src = *src;
+            c->has_src = 1;
+        }
+        else
+        {
+            c->has_src = 0;
+        }
+        c->x = x;
+        c->y = y;
+        c->w = w;
+        c->h = h;
+        c->z = 0;
+    }
+}
+
+void viewset_push_tex(ViewSet* vs, unsigned int mask, Texture* tex,
+                      float x, float y)
+{
+    viewset_push(vs, mask, tex, NULL, x, y,
+                 (float)tex->draw_w, (float)tex->draw_h);
+}
+
+void viewset_present(ViewSet* vs)
+{
+    for (int i = 0; i < vs->count; i++)
+    {
+        Viewport* v = &vs->views[i];
+
+        SDL_RenderSetViewport(vs->renderer, &v->rect);
+
+        batch_begin(vs->batch);
+        for (int k = 0; k < v->count; k++)
+        {
+            RenderCmd* c = &v->cmds[k];
+            batch_push(vs->batch, c->tex, c->has_src ? &c->src : NULL,
+                       c->x - v->cam.pos.x, c->y - v->cam.pos.y,
+                       c->w, c->h);
+        }
+        batch_flush(vs->batch);
+    }
+
+    SDL_RenderSetViewport(vs->renderer, NULL);
+}
@@ -0,0 +1,223 @@
+#include "WorldStream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void chunk_path(char* out, size_t cap, const char* dir, int cx, int cy)
+{
+    snprintf(out, cap, "%s/chunk_%d_%d.bin", dir, cx, cy);
+}
+
+static int wstream_thread(void* data)
+{
+    WorldStream* ws = data;
+
+    for (;;)
+    {
+        SDL_SemWait(ws->req_sem);
+        if (!ws->running)
+            break;
+
+        SDL_LockMutex(ws->lock);
+        WorldStreamJob job = ws->req_ring[ws->req_tail];
+        ws->req_tail = (ws->req_tail + 1) % WSTREAM_MAX_PENDING;
+        SDL_UnlockMutex(ws->lock);
+
+        // the only disk access in the whole streamer happens here
+        char path[WSTREAM_PATH_MAX + 32];
+        chunk_path(path, sizeof(path), ws->dir, job.cx, job.cy);
+
+        FILE* f = fopen(path, "rb");
+        if (f)
+        {
+            job.found = fread(job.tiles, 1, sizeof(job.tiles), f) == sizeof(job.tiles);
+            fclose(f);
+        }
+        else
+        {
+            job.found = 0;  // no file = legitimately empty chunk
+        }
+
+        SDL_LockMutex(ws->lock);
+        ws->done_ring[ws->done_head] = job;
+        ws->done_head = (ws->done_head + 1) % WSTREAM_MAX_PENDING;
+        SDL_UnlockMutex(ws->lock);
+    }
+
+    return 0;
+}
+
+int wstream_init(WorldStream* ws, Tilemap* map, const char* dir, int radius_chunks)
+{
+    memset(ws, 0, sizeof(*ws));
+
+    ws->map = map;
+    ws->radius = radius_chunks > 0 ? radius_chunks : 1;
+
+    strncpy(ws->dir, dir, WSTREAM_PATH_MAX - 1);
+    ws->dir[WSTREAM_PATH_MAX - 1] = '\0';
+
+    ws->state = calloc((size_t)map->chunks_x * map->chunks_y, sizeof(Uint8));
+    ws->lock = SDL_CreateMutex();
+    ws->req_sem = SDL_CreateSemaphore(0);
+
+    if (!ws->state || !ws->lock || !ws->req_sem)
+    {
+        printf("wstream_init failed: %s\n", SDL_GetError());
+        wstream_shutdown(ws);
+        return 0;
+    }
+
+    ws->running = 1;
+    ws->worker = SDL_CreateThread(wstream_thread, "wstream", ws);
+    if (!ws->worker)
+    {
+        printf("wstream_init: SDL_CreateThread failed: %s\n", SDL_GetError());
+        ws->running = 0;
+        wstream_shutdown(ws);
+        return 0;
+    }
+
+    return 1;
+}
+
+void wstream_shutdown(WorldStream* ws)
+{
+    if (ws->worker)
+    {
+        ws->running = 0;
+        SDL_SemPost(ws->req_sem);
+        SDL_WaitThread(ws->worker, NULL);
+        ws->worker = NULL;
+    }
+
+    if (ws->req_sem) { SDL_DestroySemaphore(ws->req_sem); ws->req_sem = NULL; }
+    if (ws->lock)    { SDL_DestroyMutex(ws->lock); ws->lock = NULL; }
+
+    free(ws->state);
+    ws->state = NULL;
+    ws->running = 0;
+}
+
+/* copy a finished read into the map and recount the chunk's tiles */
+static void apply_chunk(WorldStream* ws, const WorldStreamJob* job)
+{
+    Tilemap* m = ws->map;
+    TileChunk* c = &m->chunks[job->cy * m->chunks_x + job->cx];
+
+    if (job->found)
+    {
+        memcpy(c->tiles, job->tiles, sizeof(c->tiles));
+
+        c->used = 0;
+        for (int i = 0; i < TILEMAP_CHUNK * TILEMAP_CHUNK; i++)
+            if (c->tiles[i]) c->used++;
+    }
+    else
+    {
+        memset(c->tiles, 0, sizeof(c->tiles));
+        c->used = 0;
+    }
+
+    ws->state[job->cy * ws->map->chunks_x + job->cx] = WSTREAM_RESIDENT;
+}
+
+void wstream_update(WorldStream* ws, Vec2 cam, float view_w, float view_h)
+{
+    Tilemap* m = ws->map;
+
+    float chunk_w = m->tile_w * TILEMAP_CHUNK;
+    float chunk_h = m->tile_h * TILEMAP_CHUNK;
+
+    // wanted ring: view plus the prefetch radius
+    int cx0 = (int)(cam.x / chunk_w) - ws->radius;
+    int cy0 = (int)(cam.y / chunk_h) - ws->radius;
+    int cx1 = (int)((cam.x + view_w) / chunk_w) + ws->radius;
+    int cy1 = (int)((cam.y + view_h) / chunk_h) + ws->radius;
+
+    if (cx0 < 0) cx0 = 0;
+    if (cy0 < 0) cy0 = 0;
+    if (cx1 >= m->chunks_x) cx1 = m->chunks_x - 1;
+    if (cy1 >= m->chunks_y) cy1 = m->chunks_y - 1;
+
+    // 1) apply whatever the worker finished since last tick
+    SDL_LockMutex(ws->lock);
+    while (ws->done_tail != ws->done_head)
+    {
+        WorldStreamJob job = ws->done_ring[ws->done_tail];
+        ws->done_tail = (ws->done_tail + 1) % WSTREAM_MAX_PENDING;
+        ws->in_flight--;
+        apply_chunk(ws, &job);
+    }
+    SDL_UnlockMutex(ws->lock);
+
+    // 2) queue loads for wanted chunks we don't have yet
+    for (int cy = cy0; cy <= cy1; cy++)
+    {
+        for (int cx = cx0; cx <= cx1; cx++)
+        {
+            Uint8* st = &ws->state[cy * m->chunks_x + cx];
+            if (*st != WSTREAM_EMPTY)
+                continue;
+
+            SDL_LockMutex(ws->lock);
+            int full = ws->in_flight >= WSTREAM_MAX_PENDING;
+            if (!full)
+            {
+                WorldStreamJob* job = &ws->req_ring[ws->req_head];
+                ws->req_head = (ws->req_head + 1) % WSTREAM_MAX_PENDING;
+                job->cx = cx;
+                job->cy = cy;
+                ws->in_flight++;
+            }
+            SDL_UnlockMutex(ws->lock);
+
+            if (full)
+                return;     // ring is busy; try again next tick
+
+            *st = WSTREAM_LOADING;
+            SDL_SemPost(ws->req_sem);
+        }
+    }
+
+    // 3) evict resident chunks that fell out of the ring
+    for (int cy = 0; cy < m->chunks_y; cy++)
+    {
+        for (int cx = 0; cx < m->chunks_x; cx++)
+        {
+            if (cx >= cx0 && cx <= cx1 && cy >= cy0 && cy <= cy1)
+                continue;
+
+            Uint8* st = &ws->state[cy * m->chunks_x + cx];
+            if (*st != WSTREAM_RESIDENT)
+                continue;   // in-flight loads finish, then age out next tick
+
+            TileChunk* c = &m->chunks[cy * m->chunks_x + cx];
+            memset(c->tiles, 0, sizeof(c->tiles));
+            c->used = 0;
+            *st = WSTREAM_EMPTY;
+        }
+    }
+}
+
+int wstream_save_chunk(const Tilemap* map, const char* dir, int cx, int cy)
+{
+    if (cx < 0 || cy < 0 || cx >= map->chunks_x || cy >= map->chunks_y)
+        return 0;
+
+    char path[WSTREAM_PATH_MAX + 32];
+    chunk_path(path, sizeof(path), dir, cx, cy);
+
+    FILE* f = fopen(path, "wb");
+    if (!f)
+    {
+        printf("wstream_save_chunk: cannot write '%s'\n", path);
+        return 0;
+    }
+
+    const TileChunk* c = &map->chunks[cy * map->chunks_x + cx];
+    int ok = fwrite(c->tiles, 1, sizeof(c->tiles), f) == sizeof(c->tiles);
+    fclose(f);
+
+    return ok;
+}
@@ -1,187 +1,243 @@
 #define SDL_MAIN_HANDLED
-#include <stdio.h>
 #include "Global.h"
 
-int main(void)
+#define WIN_W 800.0f
+#define WIN_H 600.0f
+#define TICK_HZ 120
+
+typedef struct Game
 {
-    setvbuf(stdout, NULL, _IONBF, 0);
+    RenderWindow window;
+    SpriteBatch batch;
+    Atlas atlas;
 
-    if (SDL_Init(SDL_INIT_VIDEO) != 0) return 1;
-    if (!(IMG_Init(IMG_INIT_PNG | IMG_INIT_JPG))) return 1;
+    Texture grass;
+    Texture chr_front;
+    Texture chr_idle;
+    Texture chr_walkA;
+    Texture chr_walkB;
+    Texture chr_jump;
 
-    const float WIN_W = 800.0f;
-    const float WIN_H = 600.0f;
+    Texture* anim_idle[1];
+    Texture* anim_walk[2];
+    Texture* anim_jump[1];
 
-    RenderWindow window;
-    window_init(&window, "Camera + Animation Test", (int)WIN_W, (int)WIN_H);
+    Tilemap map;
 
-    // ---- Ground tile ----
-    Texture grass = (Texture){0};
-    load_tex(&grass, window.renderer, "res/gfx/ground_grass_1.png");
-    scale_tex(&grass, 64, 64);
-
-    // ---- Character sprites ----
-    Texture chr_front = (Texture){0};
-    Texture chr_idle  = (Texture){0};
-    Texture chr_walkA = (Texture){0};
-    Texture chr_walkB = (Texture){0};
-    Texture chr_jump  = (Texture){0};
-
-    load_tex(&chr_front, window.renderer, "res/gfx/character_green_front.png");
-    load_tex(&chr_idle,  window.renderer, "res/gfx/character_green_idle.png");
-    load_tex(&chr_walkA, window.renderer, "res/gfx/character_green_walk_a.png");
-    load_tex(&chr_walkB, window.renderer, "res/gfx/character_green_walk_b.png");
-    load_tex(&chr_jump,  window.renderer, "res/gfx/character_green_jump.png");
+    Entity player;
+    Vec2 prev_pos;      // position at the previous tick, for render interpolation
+    Vec2 vel;
+    int on_ground;
 
-    // scale all character sprites to tile size
-    Texture* charTexs[] = { &chr_front, &chr_idle, &chr_walkA, &chr_walkB, &chr_jump };
-    for (int i = 0; i < (int)(sizeof(charTexs) / sizeof(charTexs[0])); i++)
-        scale_tex(charTexs[i], grass.draw_w, grass.draw_h);
+    float speed;
+    float gravity;
+    float jump_v;
 
-    // ---- Anim sets ----
-    Texture* ANIM_IDLE[] = { &chr_idle };            // or &chr_front if you prefer
-    Texture* ANIM_WALK[] = { &chr_walkA, &chr_walkB };
-    Texture* ANIM_JUMP[] = { &chr_jump };
+    float pw, ph;       // player AABB size
 
-    // ---- World / Level ----
-    float world_w = 3000.0f;
-    float world_h = 600.0f;
+    Camera cam;
 
-    float tilew = (float)grass.draw_w;
-    float tileh = (float)grass.draw_h;
+    float world_w;
+    float world_h;
 
-    float plat_x = 0.0f;
-    float plat_y = 450.0f;
-    int   plat_n = (int)(world_w / tilew);  // fill the whole world with a platform row
+    int show_prof;      // F1 toggles the profiler overlay
+} Game;
 
-    // ---- Player ----
-    Entity player;
-    entity_init(&player, 200.0f, 100.0f);
-    entity_play_anim(&player, ANIM_IDLE, 1, 1.0f);
+static void game_update(float dt, void* user)
+{
+    Game* g = user;
 
-    Vec2 vel = vec2(0.0f, 0.0f);
-    int on_ground = 0;
+    prof_begin("update");
 
-    float speed   = 220.0f;
-    float gravity = 1800.0f;
-    float jump_v  = -650.0f;
+    g->prev_pos = g->player.pos;
+
+    // ---- Movement ----
+    float ax = axis_keys(SDL_SCANCODE_A, SDL_SCANCODE_D);
+
+    g->vel.x = ax * g->speed;
+
+    if (g->on_ground && IsKeyPressed(SDL_SCANCODE_SPACE))
+    {
+        g->vel.y = g->jump_v;
+        g->on_ground = 0;
+    }
+
+    g->vel.y += g->gravity * dt;
+
+    // ---- Move + collide against the tile grid ----
+    g->on_ground = tilemap_collide(&g->map, &g->player.pos.x, &g->player.pos.y,
+                                   g->pw, g->ph, &g->vel.x, &g->vel.y, dt);
+
+    // ---- Clamp player to WORLD bounds (not window) ----
+    rect_clamp_to_window(&g->player.pos.x, &g->player.pos.y,
+                         g->pw, g->ph, g->world_w, g->world_h);
+
+    // ---- Choose animation ----
+    if (!g->on_ground)
+        entity_play_anim(&g->player, g->anim_jump, 1, 1.0f);
+    else if (ax != 0.0f)
+        entity_play_anim(&g->player, g->anim_walk, 2, 8.0f);
+    else
+        entity_play_anim(&g->player, g->anim_idle, 1, 1.0f);
+
+    entity_update(&g->player, dt);
+
+    prof_end();
+}
+
+static void game_render(float alpha, void* user)
+{
+    Game* g = user;
 
-    float pw = (float)chr_idle.draw_w;
-    float ph = (float)chr_idle.draw_h;
+    // interpolate between the last two ticks so rendering stays smooth
+    // at any frame rate
+    Vec2 ip = vec2_add(g->prev_pos,
+                       vec2_scale(vec2_sub(g->player.pos, g->prev_pos), alpha));
 
-    // ---- Camera ----
-    Vec2 cam = vec2(0.0f, 0.0f);
+    // ---- Camera follow + clamp ----
+    camera_follow(&g->cam, vec2(ip.x + g->pw * 0.5f, ip.y + g->ph * 0.5f), 0.0f);
+    camera_clamp_world(&g->cam, g->world_w, g->world_h);
 
-    Uint32 last = SDL_GetTicks();
-    int running = 1;
-    SDL_Event e;
+    // ---- Render ----
+    prof_begin("render");
 
-    while (running)
+    window_clear(&g->window);
+    batch_begin(&g->batch);
+
+    tilemap_draw(&g->map, &g->batch, g->cam.pos, WIN_W, WIN_H);
+
+    if (cam_cull_rect(&g->cam, ip.x, ip.y, g->pw, g->ph))
     {
-        float dt = time_dt(&last);
+        Vec2 p = camera_apply(&g->cam, ip);
+        batch_push_tex(&g->batch, g->player.tex, p.x, p.y);
+    }
 
-        while (SDL_PollEvent(&e))
-            if (e.type == SDL_QUIT) running = 0;
+    batch_flush(&g->batch);
 
-        UpdateInput();
+    // F1 toggles the profiler overlay
+    if (IsKeyPressed(SDL_SCANCODE_F1))
+        g->show_prof = !g->show_prof;
 
-        // ---- Movement ----
-        float ax = axis_keys(SDL_SCANCODE_A, SDL_SCANCODE_D);
+    if (g->show_prof)
+    {
+        prof_draw_overlay(g->window.renderer, 8, 8, 10.0f);
 
-        vel.x = ax * speed;
+        // zone names + last-frame ms next to the bars
+        ProfZoneStats stats[PROF_MAX_ZONES];
+        int n = prof_get_stats(stats, PROF_MAX_ZONES);
 
-        if (on_ground && IsKeyPressed(SDL_SCANCODE_SPACE))
+        batch_begin(&g->batch);
+        for (int i = 0; i < n; i++)
         {
-            vel.y = jump_v;
-            on_ground = 0;
+            float ty = 8.0f + (float)i * 10.0f;
+            dtext_draw(&g->batch, stats[i].name, 216.0f, ty, 1);
+            dtext_draw_float(&g->batch, stats[i].last_ms, 2, 260.0f, ty, 1);
         }
 
-        vel.y += gravity * dt;
+        // runtime mallocs last frame — should read 0 in steady state
+        float ay = 8.0f + (float)n * 10.0f;
+        dtext_draw(&g->batch, "alloc", 216.0f, ay, 1);
+        dtext_draw_int(&g->batch, (long)mem_frame_heap_allocs(), 260.0f, ay, 1);
 
-        player.pos.x += vel.x * dt;
-        player.pos.y += vel.y * dt;
+        batch_flush(&g->batch);
+    }
 
-        // ---- Collide with platform row (top-only landing) ----
-        on_ground = 0;
+    prof_end();
 
-        // Only check tiles near the player (fast)
-        int i0 = (int)((player.pos.x - plat_x) / tilew) - 2;
-        int i1 = i0 + 6;
-        if (i0 < 0) i0 = 0;
-        if (i1 > plat_n) i1 = plat_n;
+    prof_begin("present");
+    window_present(&g->window);
+    prof_end();
 
-        for (int i = i0; i < i1; i++)
-        {
-            float tx = plat_x + i * tilew;
-            float ty = plat_y;
-
-            if (rect_overlaps(player.pos.x, player.pos.y, pw, ph, tx, ty, tilew, tileh))
-            {
-                if (vel.y > 0.0f && (player.pos.y + ph - vel.y * dt) <= ty)
-                {
-                    player.pos.y = ty - ph;
-                    vel.y = 0.0f;
-                    on_ground = 1;
-                }
-            }
-        }
+    prof_frame_end();
+}
+
+int main(void)
+{
+    if (SDL_Init(SDL_INIT_VIDEO) != 0) return 1;
+    if (!(IMG_Init(IMG_INIT_PNG | IMG_INIT_JPG))) return 1;
+
+    static Game g;
 
-        // ---- Clamp player to WORLD bounds (not window) ----
-        rect_clamp_to_window(&player.pos.x, &player.pos.y, pw, ph, world_w, world_h);
+    window_init(&g.window, "Camera + Animation Test", (int)WIN_W, (int)WIN_H);
+    batch_init(&g.batch, g.window.renderer, 0);
+    dtext_init(g.window.renderer);
 
-        // ---- Choose animation ----
-        if (!on_ground)
-            entity_play_anim(&player, ANIM_JUMP, 1, 1.0f);
-        else if (ax != 0.0f)
-            entity_play_anim(&player, ANIM_WALK, 2, 8.0f);
-        else
-            entity_play_anim(&player, ANIM_IDLE, 1, 1.0f);
+    // ---- Pack all demo art into one sheet so the batcher never
+    //      has to switch textures between tiles and character frames ----
+    const char* art[] = {
+        "res/gfx/ground_grass_1.png",
+        "res/gfx/character_green_front.png",
+        "res/gfx/character_green_idle.png",
+        "res/gfx/character_green_walk_a.png",
+        "res/gfx/character_green_walk_b.png",
+        "res/gfx/character_green_jump.png",
+    };
 
-        entity_update(&player, dt);
+    atlas_build(&g.atlas, g.window.renderer, art, (int)(sizeof(art) / sizeof(art[0])));
 
-        // ---- Camera follow + clamp ----
-        cam_follow(&cam.x, &cam.y,
-                   player.pos.x + pw * 0.5f,
-                   player.pos.y + ph * 0.5f,
-                   WIN_W, WIN_H);
+    // ---- Ground tile ----
+    atlas_get(&g.atlas, "res/gfx/ground_grass_1.png", &g.grass);
+    scale_tex(&g.grass, 64, 64);
 
-        cam_clamp(&cam.x, &cam.y, WIN_W, WIN_H, world_w, world_h);
+    // ---- Character sprites (views into the atlas) ----
+    atlas_get(&g.atlas, "res/gfx/character_green_front.png",  &g.chr_front);
+    atlas_get(&g.atlas, "res/gfx/character_green_idle.png",   &g.chr_idle);
+    atlas_get(&g.atlas, "res/gfx/character_green_walk_a.png", &g.chr_walkA);
+    atlas_get(&g.atlas, "res/gfx/character_green_walk_b.png", &g.chr_walkB);
+    atlas_get(&g.atlas, "res/gfx/character_green_jump.png",   &g.chr_jump);
 
-        // ---- Render ----
-        window_clear(&window);
+    // scale all character sprites to tile size
+    Texture* charTexs[] = { &g.chr_front, &g.chr_idle, &g.chr_walkA, &g.chr_walkB, &g.chr_jump };
+    for (int i = 0; i < (int)(sizeof(charTexs) / sizeof(charTexs[0])); i++)
+        scale_tex(charTexs[i], g.grass.draw_w, g.grass.draw_h);
 
-        // draw platform row with camera + simple culling
-        int first = (int)(cam.x / tilew) - 2;
-        int lasti = first + (int)(WIN_W / tilew) + 6;
+    // ---- Anim sets ----
+    g.anim_idle[0] = &g.chr_idle;           // or &g.chr_front if you prefer
+    g.anim_walk[0] = &g.chr_walkA;
+    g.anim_walk[1] = &g.chr_walkB;
+    g.anim_jump[0] = &g.chr_jump;
 
-        if (first < 0) first = 0;
-        if (lasti > plat_n) lasti = plat_n;
+    // ---- World / Level ----
+    g.world_w = 3000.0f;
+    g.world_h = 600.0f;
 
-        for (int i = first; i < lasti; i++)
-        {
-            float wx = plat_x + i * tilew;
-            float wy = plat_y;
+    float tilew = (float)g.grass.draw_w;
+    float tileh = (float)g.grass.draw_h;
 
-            Vec2 s = cam_apply(vec2(wx, wy), cam);
-            draw_tex(&grass, window.renderer, s.x, s.y);
-        }
+    tilemap_init(&g.map, (int)(g.world_w / tilew), (int)(g.world_h / tileh) + 1, tilew, tileh);
+    tilemap_set_tileset(&g.map, 1, &g.grass);
 
-        // draw player with camera
-        Vec2 p = cam_apply(player.pos, cam);
-        draw_tex(player.tex, window.renderer, p.x, p.y);
+    // fill the whole world with a platform row
+    int ground_ty = 7;
+    tilemap_fill_row(&g.map, ground_ty, 0, g.map.width, 1);
 
-        window_present(&window);
-    }
+    // ---- Player ----
+    entity_init(&g.player, 200.0f, 100.0f);
+    entity_play_anim(&g.player, g.anim_idle, 1, 1.0f);
+    g.prev_pos = g.player.pos;
+
+    g.vel = vec2(0.0f, 0.0f);
+    g.on_ground = 0;
+
+    g.speed   = 220.0f;
+    g.gravity = 1800.0f;
+    g.jump_v  = -650.0f;
+
+    g.pw = (float)g.chr_idle.draw_w;
+    g.ph = (float)g.chr_idle.draw_h;
+
+    camera_init(&g.cam, WIN_W, WIN_H);
+
+    // ---- Run: physics at a fixed tick, rendering interpolated ----
+    engine_loop(game_update, game_render, TICK_HZ, &g);
 
-    // cleanup
-    destroy_tex(&chr_front);
-    destroy_tex(&chr_idle);
-    destroy_tex(&chr_walkA);
-    destroy_tex(&chr_walkB);
-    destroy_tex(&chr_jump);
-    destroy_tex(&grass);
+    // cleanup (character/grass textures are views into the atlas sheet)
+    tilemap_destroy(&g.map);
+    atlas_destroy(&g.atlas);
 
-    window_destroy(&window);
+    dtext_shutdown();
+    batch_destroy(&g.batch);
+    window_destroy(&g.window);
     IMG_Quit();
     SDL_Quit();
     return 0;
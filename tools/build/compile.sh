@@ -11,12 +11,13 @@ SRC="src/*.c src/engine/*.c"
 INCLUDES="-Iinclude"
 OUT_DEBUG="bin/debug/main_debug"
 OUT_RELEASE="bin/release/main_release"
+OUT_BENCH="bin/bench/bench"
 
 # SDL flags from system
 SDL_CFLAGS="$(sdl2-config --cflags)"
 SDL_LIBS="$(sdl2-config --libs) -lSDL2_image"
 
-mkdir -p bin/debug bin/release
+mkdir -p bin/debug bin/release bin/bench
 
 case "$1" in
   debug)
@@ -39,10 +40,21 @@ case "$1" in
     echo "Built: $OUT_RELEASE"
     ;;
 
+  bench)
+    echo "[SDLite] Building BENCH..."
+    $CC $CFLAGS_COMMON -O2 -DNDEBUG \
+      $INCLUDES $SDL_CFLAGS \
+      src/bench/*.c src/engine/*.c \
+      -o "$OUT_BENCH" \
+      $SDL_LIBS
+    echo "Built: $OUT_BENCH"
+    ;;
+
   *)
     echo "Usage:"
     echo "  ./compile.sh debug"
     echo "  ./compile.sh release"
+    echo "  ./compile.sh bench"
     exit 1
     ;;
 esac
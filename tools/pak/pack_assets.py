@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Pack images into a .sdlpak bundle for SDLite.
+
+The engine opens the bundle with a single read at startup instead of
+one open+decode per file. With --raw, images are pre-decoded to RGBA32
+so the runtime skips PNG inflate entirely and uploads pixels straight
+to the GPU (requires Pillow).
+
+Usage:
+  python3 tools/pak/pack_assets.py res/gfx/*.png -o res/assets.sdlpak
+  python3 tools/pak/pack_assets.py res/gfx/*.png -o res/assets.sdlpak --raw
+
+Format (little-endian):
+  header:  "SPAK", u32 version=1, u32 count
+  entries: name[64], u32 offset, u32 size, u32 format, u32 w, u32 h
+           format 0 = raw RGBA32 pixels, 1 = encoded image file bytes
+  data blob
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"SPAK"
+VERSION = 1
+NAME_MAX = 64
+
+FORMAT_RAW = 0
+FORMAT_ENCODED = 1
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Pack images into a .sdlpak bundle")
+    ap.add_argument("inputs", nargs="+", help="image files to pack")
+    ap.add_argument("-o", "--output", required=True, help="output .sdlpak path")
+    ap.add_argument("--raw", action="store_true",
+                    help="pre-decode to RGBA32 (needs Pillow; skips PNG inflate at runtime)")
+    args = ap.parse_args()
+
+    if args.raw:
+        try:
+            from PIL import Image
+        except ImportError:
+            sys.exit("--raw needs Pillow: pip install Pillow")
+
+    entries = []
+    blob = bytearray()
+
+    for path in args.inputs:
+        name = path.replace("\\", "/").encode()
+        if len(name) >= NAME_MAX:
+            sys.exit(f"name too long (max {NAME_MAX - 1}): {path}")
+
+        if args.raw:
+            from PIL import Image
+            img = Image.open(path).convert("RGBA")
+            data = img.tobytes()
+            fmt, w, h = FORMAT_RAW, img.width, img.height
+        else:
+            with open(path, "rb") as f:
+                data = f.read()
+            fmt, w, h = FORMAT_ENCODED, 0, 0
+
+        entries.append((name, len(blob), len(data), fmt, w, h))
+        blob += data
+
+    data_start = 12 + len(entries) * (NAME_MAX + 20)
+
+    with open(args.output, "wb") as out:
+        out.write(struct.pack("<4sII", MAGIC, VERSION, len(entries)))
+        for name, offset, size, fmt, w, h in entries:
+            out.write(struct.pack(f"<{NAME_MAX}sIIIII",
+                                  name, data_start + offset, size, fmt, w, h))
+        out.write(blob)
+
+    kind = "raw RGBA32" if args.raw else "encoded"
+    print(f"packed {len(entries)} files ({kind}) into {args.output} "
+          f"({data_start + len(blob)} bytes)")
+
+
+if __name__ == "__main__":
+    main()